@@ -1,3 +1,7 @@
+# root directory of cpp_stm32, so that the functions below also work for projects that include this file from other
+# places, e.g. host test (test/host)
+get_filename_component(CPP_STM32_ROOT_DIR ${CMAKE_CURRENT_LIST_DIR}/.. ABSOLUTE)
+
 # * Import board settings checks target board validity and import related variables
 #
 # This macro checks if the target board is supported by cpp_stm32 and import all variables needed to
@@ -68,7 +72,7 @@ function(gen_project_config_file)
   set(multi_value_arg)
   cmake_parse_arguments("_" "${option_arg}" "${single_value_arg}" "${multi_value_arg}" ${ARGN})
 
-  set(CLOCK_FILE_ABS_DIR ${CMAKE_SOURCE_DIR}/tool/clock_generator/${__CLOCK_FILE})
+  set(CLOCK_FILE_ABS_DIR ${CPP_STM32_ROOT_DIR}/tool/clock_generator/${__CLOCK_FILE})
   if (NOT EXISTS ${CLOCK_FILE_ABS_DIR})
     message(FATAL_ERROR "clock file doesn't exist, aborted")
   endif()
@@ -78,14 +82,14 @@ function(gen_project_config_file)
     message(STATUS "Generating project_config.hxx")
     set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${CLOCK_FILE_ABS_DIR})
     execute_process(
-        COMMAND ${Python3_EXECUTABLE} ${CMAKE_SOURCE_DIR}/tool/clock_generator/clock_generator.py ${__CLOCK_FILE}
+        COMMAND ${Python3_EXECUTABLE} ${CPP_STM32_ROOT_DIR}/tool/clock_generator/clock_generator.py ${__CLOCK_FILE}
                 ${__BOARD} ${CMAKE_CURRENT_BINARY_DIR}/project_config.hxx
-                WORKING_DIRECTORY ${CMAKE_SOURCE_DIR}/tool/clock_generator)
+                WORKING_DIRECTORY ${CPP_STM32_ROOT_DIR}/tool/clock_generator)
   else()
     message(FATAL_ERROR "can't find python3 to generate clock info, aborted")
   endif()
 
-  file(READ ${CMAKE_SOURCE_DIR}/cmake/project_config.hxx.in CONFIG_H_IN)
+  file(READ ${CPP_STM32_ROOT_DIR}/cmake/project_config.hxx.in CONFIG_H_IN)
   file(READ ${CMAKE_CURRENT_BINARY_DIR}/project_config.hxx ORIGINAL_CONTENT)
   string(CONFIGURE "${CONFIG_H_IN}" CONFIG_H_TMP)
   file(
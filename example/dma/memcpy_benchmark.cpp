@@ -0,0 +1,114 @@
+/**
+ * @file  example/dma/memcpy_benchmark.cpp
+ * @brief	Locate the size above which DMA2 copy is faster than CPU copy, see dma::MEM_TRANSFER_CPU_THRESHOLD
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "sys_init.hxx"
+
+#include "cpp_stm32/driver/usart_serial.hxx"
+#include "cpp_stm32/processor/cortex_m4/dwt.hxx"
+
+#include "dma_memcpy.hxx"
+
+namespace Driver = cpp_stm32::driver;
+namespace Gpio	 = cpp_stm32::gpio;
+namespace Rcc		 = cpp_stm32::rcc;
+namespace Dma		 = cpp_stm32::dma;
+namespace Dwt		 = cpp_stm32::dwt;
+namespace Sys		 = cpp_stm32::sys;
+
+using cpp_stm32::usart::operator"" _Baud;
+
+static constexpr std::size_t MAX_SIZE = 4096;
+
+alignas(16) std::array<std::uint8_t, MAX_SIZE> src_buffer;
+alignas(16) std::array<std::uint8_t, MAX_SIZE> dst_buffer;
+
+bool volatile copy_done = false;
+
+void on_copy_done() noexcept { copy_done = true; }
+
+Driver::Usart const pc{Driver::UsartTx_v<Gpio::PinName::PA_2>, Driver::UsartRx_v<Gpio::PinName::PA_3>, 115200_Baud};
+
+/**
+ * @brief		This function returns cycles of t_func, measured by DWT cycle counter
+ */
+template <typename Func>
+std::uint32_t measure(Func&& t_func) noexcept {
+	auto const start = Dwt::get_cycle_count();
+	t_func();
+	return Dwt::get_cycle_count() - start;
+}
+
+/**
+ * @brief		This function returns whether the first t_size byte of dst_buffer equal to that of src_buffer, then clears
+ * 					dst_buffer for the next copy
+ */
+bool check_and_clear(std::size_t const t_size) noexcept {
+	bool const equal = std::memcmp(dst_buffer.data(), src_buffer.data(), t_size) == 0;
+	dst_buffer.fill(0);
+	return equal;
+}
+
+int main() {
+	Sys::Clock<>::init();
+
+	Rcc::enable_periph_clk<Rcc::PeriphClk::Dma2>();
+	Dwt::enable_cycle_counter();
+
+	for (std::size_t i = 0; i < MAX_SIZE; ++i) {
+		src_buffer[i] = static_cast<std::uint8_t>(i * 7U + 1U);
+	}
+
+	// print "size, cpu cycles, dma cycles (polled), dma cycles (with callback), copy result", the crossover point is where
+	// the dma cycles become smaller than cpu cycles, cycles of a row are meaningless if the copy result isn't ok
+	pc << "size, cpu, dma, dma_irq, result\n\r";
+
+	for (std::size_t size = 16; size <= MAX_SIZE; size *= 2) {
+		auto const cpu_cycle = measure([=]() { std::memcpy(dst_buffer.data(), src_buffer.data(), size); });
+		bool copy_ok				 = check_and_clear(size);
+
+		auto const dma_cycle = measure([=]() {
+			// threshold 0 to force DMA
+			Dma::memcpy_async<Dma::Stream::Stream0, 0>(dst_buffer.data(), src_buffer.data(), size).wait();
+		});
+		copy_ok = check_and_clear(size) && copy_ok;
+
+		copy_done								 = false;
+		auto const dma_irq_cycle = measure([=]() {
+			Dma::memcpy_async<Dma::Stream::Stream0, 0>(dst_buffer.data(), src_buffer.data(), size, &on_copy_done);
+			while (!copy_done) {
+			}
+		});
+		copy_ok = check_and_clear(size) && copy_ok;
+
+		pc << static_cast<std::uint32_t>(size) << ", " << cpu_cycle << ", " << dma_cycle << ", " << dma_irq_cycle << ", "
+			 << (copy_ok ? "ok" : "mismatch") << "\n\r";
+	}
+
+	while (true) {
+	}
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file  example/spi/spi_throughput.cpp
+ * @brief	Compare cycles of spi::xfer_full_duplex with the time SCLK needs at the maximum prescaler
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include "sys_init.hxx"
+
+#include "cpp_stm32/driver/spi.hxx"
+#include "cpp_stm32/driver/spi_dma.hxx"
+#include "cpp_stm32/driver/usart_serial.hxx"
+#include "cpp_stm32/processor/cortex_m4/dwt.hxx"
+
+#include "dma_allocator.hxx"
+
+namespace Driver = cpp_stm32::driver;
+namespace Gpio	 = cpp_stm32::gpio;
+namespace Rcc		 = cpp_stm32::rcc;
+namespace Dma		 = cpp_stm32::dma;
+namespace Spi		 = cpp_stm32::spi;
+namespace Dwt		 = cpp_stm32::dwt;
+namespace Sys		 = cpp_stm32::sys;
+
+using cpp_stm32::usart::operator"" _Baud;
+
+static constexpr std::uint32_t MAX_SIZE = 1024;
+
+// SCLK of prescaler 2, one SCLK period is (2 * AHB_FREQ / APB1_FREQ) core cycles
+static constexpr auto MAX_SCLK			= cpp_stm32::Frequency<cpp_stm32::APB1_FREQ / 2>{};
+static constexpr auto CYCLE_PER_BIT = 2 * cpp_stm32::AHB_FREQ / cpp_stm32::APB1_FREQ;
+
+std::array<std::uint8_t, MAX_SIZE> tx_buffer;
+std::array<std::uint8_t, MAX_SIZE> rx_buffer;
+
+using Streams					= Dma::StreamAllocator<Dma::Use<Dma::Request::Spi2Rx>, Dma::Use<Dma::Request::Spi2Tx>>;
+constexpr auto RX_DMA = Streams::get<Dma::Request::Spi2Rx>();
+constexpr auto TX_DMA = Streams::get<Dma::Request::Spi2Tx>();
+
+Driver::SpiDma<Spi::Port::SPI2, RX_DMA.port, RX_DMA.stream, TX_DMA.stream> spi_dma;
+
+Driver::Usart const pc{Driver::UsartTx_v<Gpio::PinName::PA_2>, Driver::UsartRx_v<Gpio::PinName::PA_3>, 115200_Baud};
+
+/**
+ * @brief		This function returns cycles of t_func, measured by DWT cycle counter
+ */
+template <typename Func>
+std::uint32_t measure(Func&& t_func) noexcept {
+	auto const start = Dwt::get_cycle_count();
+	t_func();
+	return Dwt::get_cycle_count() - start;
+}
+
+int main() {
+	Sys::Clock<>::init();
+	Dwt::enable_cycle_counter();
+
+	Rcc::enable_periph_clk<Rcc::PeriphClk::Dma1>();
+	spi_dma.start(RX_DMA.channel, TX_DMA.channel);
+
+	// connect PB_15 (MOSI) to PB_14 (MISO), the received data is then checked against the transmitted one
+	Driver::SPI const spi{Driver::Miso<Gpio::PinName::PB_14>{}, Driver::Mosi<Gpio::PinName::PB_15>{},
+												Driver::Sclk<Gpio::PinName::PB_13>{}, Spi::Mode::Mode0, cpp_stm32::size_c<8>{}, MAX_SCLK};
+
+	for (std::size_t i = 0; i < tx_buffer.size(); ++i) {
+		tx_buffer[i] = static_cast<std::uint8_t>(i * 7U + 1U);
+	}
+
+	// print "size, ideal cycles, full duplex cycles, dma cycles, mismatch", the bus is saturated if the measured cycles
+	// only exceed the ideal one by a constant (the first frame, and the reading of the last one)
+	pc << "size, ideal, full_duplex, dma, mismatch\n\r";
+
+	for (std::uint32_t size = 16; size <= MAX_SIZE; size *= 2) {
+		rx_buffer.fill(0);
+
+		auto const tx = cpp_stm32::Span<std::uint8_t const>{tx_buffer.data(), size};
+		auto const rx = cpp_stm32::Span<std::uint8_t>{rx_buffer.data(), size};
+
+		auto const cycle = measure([=]() { spi.xfer(tx, rx); });
+		auto const ideal = size * 8 * CYCLE_PER_BIT;
+
+		std::uint32_t mismatch = 0;
+		for (std::uint32_t i = 0; i < size; ++i) {
+			mismatch += static_cast<std::uint32_t>(tx[i] != rx[i]);
+		}
+
+		rx_buffer.fill(0);
+		auto const dma_cycle = measure([=]() {
+			spi_dma.xferAsync(tx, rx);
+			spi_dma.wait();
+		});
+
+		for (std::uint32_t i = 0; i < size; ++i) {
+			mismatch += static_cast<std::uint32_t>(tx[i] != rx[i]);
+		}
+
+		pc << size << ", " << ideal << ", " << cycle << ", " << dma_cycle << ", " << mismatch << "\n\r";
+	}
+
+	while (true) {
+	}
+
+	return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file  example/usart/deferred_log.cpp
+ * @brief	Usart example sending binary log record, render it by tool/log_decoder/log_decoder.py
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdint>
+
+#include "sys_init.hxx"
+
+#include "cpp_stm32/driver/digitalout.hxx"
+#include "cpp_stm32/driver/usart_buffered.hxx"
+#include "cpp_stm32/utility/deferred_log.hxx"
+
+namespace Driver = cpp_stm32::driver;
+namespace Gpio	 = cpp_stm32::gpio;
+namespace Log		 = cpp_stm32::log;
+namespace Usart	= cpp_stm32::usart;
+namespace Sys		 = cpp_stm32::sys;
+
+using Usart::operator"" _Baud;
+
+Driver::BufferedUsart<Gpio::PinName::PA_2, Gpio::PinName::PA_3, 256> pc{
+	Driver::UsartTx_v<Gpio::PinName::PA_2>, Driver::UsartRx_v<Gpio::PinName::PA_3>, 921600_Baud};
+
+Driver::DigitalOut<Gpio::PinName::PA_5> led;
+
+int main() {
+	Sys::Clock<>::init();
+	pc.start();
+
+	Log::DeferredLogger logger{pc};
+	std::uint32_t count = 0;
+
+	CPP_STM32_LOG(logger, "deferred log example\n");
+
+	while (true) {
+		constexpr auto SOME_INTERVAL = 1000000;
+		for (int i = 0; i < SOME_INTERVAL; ++i) {
+			__asm("nop");
+		}
+
+		++count;
+
+		// 2 + 4 + 4 byte on the wire, instead of about 25 characters
+		CPP_STM32_LOG(logger, "{} alive, {:.2f} s\n", count, static_cast<float>(count) * 0.1f);
+		led.toggle();
+	}
+
+	return 0;
+}
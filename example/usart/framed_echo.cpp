@@ -0,0 +1,90 @@
+/**
+ * @file  example/usart/framed_echo.cpp
+ * @brief	Usart example exchanging COBS framed, CRC protected packet with PC
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include "sys_init.hxx"
+
+#include "cpp_stm32/driver/digitalout.hxx"
+#include "cpp_stm32/driver/dma_ring_rx.hxx"
+#include "cpp_stm32/driver/usart_serial.hxx"
+#include "cpp_stm32/utility/cobs.hxx"
+
+#include "dma.hxx"
+#include "dma_allocator.hxx"
+
+namespace Driver = cpp_stm32::driver;
+namespace Gpio	 = cpp_stm32::gpio;
+namespace Usart	= cpp_stm32::usart;
+namespace Rcc		 = cpp_stm32::rcc;
+namespace Dma		 = cpp_stm32::dma;
+namespace Sys		 = cpp_stm32::sys;
+
+using cpp_stm32::operator"" _Hz;
+using cpp_stm32::Span;
+
+using DmaStreams		 = Dma::StreamAllocator<Dma::Use<Dma::Request::Usart2Rx>>;
+constexpr auto RX_DMA = DmaStreams::get<Dma::Request::Usart2Rx>();
+
+static constexpr std::size_t MAX_PAYLOAD = 64;
+
+/* Frame is decoded straight out of DMA buffer, into payload buffer */
+Driver::DmaRingRx<RX_DMA.port, RX_DMA.stream, 256> rx_ring;
+std::array<std::uint8_t, MAX_PAYLOAD + sizeof(cpp_stm32::Crc16Ccitt::value_type)> rx_frame{};
+cpp_stm32::CobsDecoder decoder{Span{rx_frame}};
+
+/* Reply is encoded straight into transmit buffer */
+std::array<std::uint8_t, cpp_stm32::cobs_frame_size(MAX_PAYLOAD)> tx_frame{};
+
+Driver::Usart const pc{Driver::UsartTx_v<Gpio::PinName::PA_2>, Driver::UsartRx_v<Gpio::PinName::PA_3>, 921600_Hz};
+
+Driver::DigitalOut<Gpio::PinName::PA_5> led;
+
+void decode(Span<std::uint8_t const> t_data) noexcept {
+	while (!t_data.empty()) {
+		t_data = t_data.subspan(decoder.feed(t_data));
+
+		if (decoder.complete()) {
+			pc.send(cpp_stm32::CobsEncoder{Span{tx_frame}}.write(decoder.payload()).finish());
+			led.toggle();
+		}
+	}
+}
+
+int main() {
+	Sys::Clock<>::init();
+
+	Rcc::enable_periph_clk<Rcc::PeriphClk::Dma1>();
+	rx_ring.start(Dma::PeriphAddress_t{Usart::reg::DR<Usart::Port::Usart2>.memoryAddr()}, RX_DMA.channel);
+	Usart::enable_rx_dma<Usart::Port::Usart2>();
+
+	while (true) {
+		auto const [first, second] = rx_ring.peek();
+		decode(first);
+		decode(second);
+
+		rx_ring.consume(first.size() + second.size());
+	}
+
+	return 0;
+}
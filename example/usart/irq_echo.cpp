@@ -0,0 +1,63 @@
+/**
+ * @file  example/usart/irq_echo.cpp
+ * @brief	Usart example echoing data from PC without blocking main loop
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include "sys_init.hxx"
+
+#include "cpp_stm32/driver/digitalout.hxx"
+#include "cpp_stm32/driver/usart_buffered.hxx"
+
+namespace Driver = cpp_stm32::driver;
+namespace Gpio	 = cpp_stm32::gpio;
+namespace Usart	= cpp_stm32::usart;
+namespace Sys		 = cpp_stm32::sys;
+
+using Usart::operator"" _Baud;
+
+/* Echo to PC, bytes are moved between rings and USART in interrupt */
+Driver::BufferedUsart<Gpio::PinName::PA_2, Gpio::PinName::PA_3, 128, 128> pc{
+	Driver::UsartTx_v<Gpio::PinName::PA_2>, Driver::UsartRx_v<Gpio::PinName::PA_3>, 921600_Baud};
+
+/* Toggled by main loop, keeps blinking no matter how much data is echoed */
+Driver::DigitalOut<Gpio::PinName::PA_5> led;
+
+int main() {
+	Sys::Clock<>::init();
+
+	pc.start();
+	pc.send("irq echo\r\n");
+
+	std::array<std::uint8_t, 32> buf{};
+
+	while (true) {
+		// take no more than what can be sent, the rest stays in receive ring until next loop
+		auto const room = pc.writable() < buf.size() ? pc.writable() : buf.size();
+		auto const len	= pc.receive(cpp_stm32::Span{buf}.first(room));
+		pc.send(cpp_stm32::Span<std::uint8_t const>{buf.data(), len});
+
+		led.toggle();
+	}
+
+	return 0;
+}
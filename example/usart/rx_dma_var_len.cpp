@@ -20,16 +20,16 @@
  *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <algorithm>
-#include <array>
-#include <iterator>
+#include <string_view>
 
 #include "sys_init.hxx"
 
 #include "cpp_stm32/driver/digitalout.hxx"
+#include "cpp_stm32/driver/dma_ring_rx.hxx"
 #include "cpp_stm32/driver/usart_serial.hxx"
 
 #include "dma.hxx"
+#include "dma_allocator.hxx"
 
 namespace Driver = cpp_stm32::driver;
 namespace Gpio	 = cpp_stm32::gpio;
@@ -41,33 +41,15 @@ namespace Sys		 = cpp_stm32::sys;
 
 using Usart::operator"" _Baud;
 
-/**/
-constexpr auto PACKET_LEN_IDX = 3;
-
-constexpr auto PACKET_HEADER_NUM = 2;
-constexpr auto PACKET_ID_NUM		 = 1;
-constexpr auto PACKET_LEN_NUM		 = 1;
-
-/**/
-enum class ReceiverState { TransferComplete, HalfTransfer, Idle };
+/* Global DMA define, stream and channel are looked up from request mapping */
+using DmaStreams			= Dma::StreamAllocator<Dma::Use<Dma::Request::Usart2Rx>>;
+constexpr auto RX_DMA	= DmaStreams::get<Dma::Request::Usart2Rx>();
 
-/* Global DMA define */
-constexpr auto DMA = Dma::Port::DMA1;
-constexpr auto Str = Dma::Stream::Stream5;
-
-bool packet_finish	= false; /* Signal to send */
-bool packet_tx_lock = false; /* Lock proccessed_data when transferring */
-
-/**/
-static std::size_t old_pos{0}, last_processed_idx{0};
+volatile bool packet_finish = false; /* Signal to send, set by idle line interrupt */
 
-/* Global Storage for DMA destination */
+/* DMA destination, received data is consumed in place, no copy and no lock is needed */
 static constexpr std::size_t MAX_BUFFER_SIZE = 20;
-std::array<char, MAX_BUFFER_SIZE> buffer;
-
-/* Complete message sent from PC */
-static constexpr std::size_t MAX_MESSAGE_SIZE = 10;
-char processed_data[MAX_MESSAGE_SIZE];
+Driver::DmaRingRx<RX_DMA.port, RX_DMA.stream, MAX_BUFFER_SIZE, char> rx_ring;
 
 /* Input from PC */
 Driver::Usart const pc{Driver::UsartTx_v<Gpio::PinName::PA_2>, Driver::UsartRx_v<Gpio::PinName::PA_3>, 115200_Baud};
@@ -76,30 +58,15 @@ Driver::Usart const pc{Driver::UsartTx_v<Gpio::PinName::PA_2>, Driver::UsartRx_v
 Driver::DigitalOut<Gpio::PinName::PA_5> led;
 
 /**/
-void dma1_stream5() noexcept;
 void usart2() noexcept;
 
-constexpr void setup_dma() noexcept {
+void setup_dma() noexcept {
 	constexpr auto p_addr = Usart::reg::DR<Usart::Port::Usart2>.memoryAddr();
-	constexpr auto m_addr = &buffer[0];
 
 	Rcc::enable_periph_clk<Rcc::PeriphClk::Dma1>();
-	Nvic::enable_irq<cpp_stm32::IrqNum::Dma1Stream5Global>(cpp_stm32::Callback<dma1_stream5>{});
 	Nvic::enable_irq<cpp_stm32::IrqNum::Usart2Global>(cpp_stm32::Callback<usart2>{});
 
-	Dma::reset<DMA, Str>();
-	Dma::set_transfer_mode<DMA, Str>(Dma::TransferMode::PeriphToMem);
-	Dma::set_tx_data_num<DMA, Str>(MAX_BUFFER_SIZE);
-	Dma::channel_select<DMA, Str>(Dma::Channel::Channel4);
-	Dma::set_memory_data_size<DMA, Str>(Dma::DataSize::Byte);
-	Dma::set_periph_data_size<DMA, Str>(Dma::DataSize::Byte);
-	Dma::enable_mem_increment<DMA, Str>();
-	Dma::enable_circular_mode<DMA, Str>();
-	Dma::set_address<DMA, Str>(Dma::MemoryAddress_t{(std::uintptr_t)m_addr});
-	Dma::set_address<DMA, Str>(Dma::PeriphAddress_t{p_addr});
-	Dma::set_priority<DMA, Str>(Dma::StreamPriority::Low);
-	Dma::enable_irq<DMA, Str, Dma::InterruptFlag::TCI, Dma::InterruptFlag::HTI>();
-	Dma::enable<DMA, Str>();
+	rx_ring.start(Dma::PeriphAddress_t{p_addr}, RX_DMA.channel);
 
 	Usart::enable_idle_irq<Usart::Port::Usart2>();
 	Usart::enable_rx_dma<Usart::Port::Usart2>();
@@ -117,72 +84,24 @@ int main() {
 		}
 
 		if (packet_finish) {
-			packet_finish	= false;
-			packet_tx_lock = true;
+			packet_finish = false;
 
-			pc << processed_data << "\n\t";
-			std::fill(std::begin(processed_data), std::end(processed_data), 0);
-			last_processed_idx = 0;
+			// the message may wrap around the end of DMA buffer, in which case it comes in two pieces
+			auto const [first, second] = rx_ring.peek();
+			pc << std::string_view{first.data(), first.size()} << std::string_view{second.data(), second.size()} << "\n\t";
 
-			packet_tx_lock = false;
+			rx_ring.consume(first.size() + second.size());
 		}
 	}
 
 	return 0;
 }
 
-template <auto State>
-constexpr void process_buffer() noexcept {
-	auto const current_pos = MAX_BUFFER_SIZE - Dma::get_tx_data_num<DMA, Str>();	// current dma buffer pointer position
-	std::int8_t const pos_diff = current_pos - old_pos;	// buffer received since last time process
-
-	if (constexpr auto buffer_head = std::begin(buffer); pos_diff != 0) {
-		if (pos_diff > 0) {
-			while (packet_tx_lock) {
-			}
-			std::copy(buffer_head + old_pos, buffer_head + current_pos, &processed_data[last_processed_idx]);
-			last_processed_idx = pos_diff;
-		} else {
-			// pos_diff < 0 only when TC complete, where current_pos goes to the beginnig of the buffer
-			while (packet_tx_lock) {
-			}
-			std::copy(buffer_head + old_pos, std::end(buffer), &processed_data[last_processed_idx]);
-
-			auto const packet_copied = MAX_BUFFER_SIZE - old_pos;
-			std::copy(buffer_head, buffer_head + current_pos, &processed_data[packet_copied + last_processed_idx]);
-			last_processed_idx = packet_copied + current_pos;
-		}
-	}
-
-	if (current_pos == MAX_BUFFER_SIZE) {
-		old_pos = 0;
-	} else {
-		old_pos = current_pos;
-	}
-
-	if constexpr (State == ReceiverState::Idle) {
-		packet_finish = true;	// transfer maybe aborted, or transfer finished, start parsing data
-	}
-}
-
-void dma1_stream5() noexcept {
-	if (auto const [tc_flag] = Dma::get_tx_complete_flag<DMA, Str>(); tc_flag != 0) {
-		Dma::clear_tx_complete_flag<DMA, Str>();
-
-		process_buffer<ReceiverState::TransferComplete>();
-	}
-
-	if (auto const [ht_flag] = Dma::get_half_tx_flag<DMA, Str>(); ht_flag != 0) {
-		Dma::clear_half_tx_flag<DMA, Str>();
-
-		process_buffer<ReceiverState::HalfTransfer>();
-	}
-}
-
 void usart2() noexcept {
 	if (auto const [idle_flag] = Usart::get_interrupt_flag<Usart::Port::Usart2, Usart::InterruptFlag::IDLE>();
 			idle_flag != 0) {
 		[[gnu::unused]] auto const clear_idle = Usart::receive<Usart::Port::Usart2>();
-		process_buffer<ReceiverState::Idle>();
+
+		packet_finish = true;	// transfer maybe aborted, or transfer finished, start parsing data
 	}
 }
@@ -0,0 +1,82 @@
+/**
+ * @file  example/usart/tx_dma_queue.cpp
+ * @brief	Usart example sending messages by DMA while main loop keeps running
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "sys_init.hxx"
+
+#include "cpp_stm32/driver/digitalout.hxx"
+#include "cpp_stm32/driver/usart_dma_tx.hxx"
+#include "cpp_stm32/driver/usart_serial.hxx"
+
+#include "dma_allocator.hxx"
+
+namespace Driver = cpp_stm32::driver;
+namespace Gpio	 = cpp_stm32::gpio;
+namespace Usart	= cpp_stm32::usart;
+namespace Rcc		 = cpp_stm32::rcc;
+namespace Dma		 = cpp_stm32::dma;
+namespace Sys		 = cpp_stm32::sys;
+
+using Usart::operator"" _Baud;
+
+using DmaStreams			= Dma::StreamAllocator<Dma::Use<Dma::Request::Usart2Tx>>;
+constexpr auto TX_DMA = DmaStreams::get<Dma::Request::Usart2Tx>();
+
+/* Output to PC, configured by blocking driver, then served by DMA */
+constexpr std::size_t QUEUE_DEPTH = 4;
+Driver::Usart const pc{Driver::UsartTx_v<Gpio::PinName::PA_2>, Driver::UsartRx_v<Gpio::PinName::PA_3>, 115200_Baud};
+Driver::UsartDmaTx<Usart::Port::Usart2, TX_DMA.port, TX_DMA.stream, QUEUE_DEPTH> tx;
+
+/* Toggled by main loop, keeps blinking while messages are being sent */
+Driver::DigitalOut<Gpio::PinName::PA_5> led;
+
+int main() {
+	Sys::Clock<>::init();
+
+	Rcc::enable_periph_clk<Rcc::PeriphClk::Dma1>();
+	tx.start(TX_DMA.channel);
+
+	// one buffer per queue slot, if the queue is not full, the message that used the next slot is already sent
+	constexpr auto MSG_SIZE = 16;
+	std::array<std::array<char, MSG_SIZE>, QUEUE_DEPTH> msg_buffer{};
+	std::uint32_t msg_count = 0;
+
+	while (true) {
+		if (tx.pending() < QUEUE_DEPTH) {
+			auto& buf		 = msg_buffer[msg_count % QUEUE_DEPTH];
+			auto const end = std::to_chars(buf.data(), buf.data() + buf.size() - 1, msg_count).ptr;
+			*end					 = '\n';
+
+			tx.send(std::string_view{buf.data(), static_cast<std::size_t>(end + 1 - buf.data())});
+			++msg_count;
+		}
+
+		led.toggle();
+	}
+
+	return 0;
+}
@@ -20,6 +20,8 @@
  *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
+
 #include "cpp_stm32/driver/digitalout.hxx"
 #include "cpp_stm32/driver/usart_serial.hxx"
 #include "sys_init.hxx"
@@ -36,13 +38,17 @@ int main() {
 	Usart pc{UsartTx_v<PinName::PA_2>, UsartRx_v<PinName::PA_3>, 115200_Baud};
 	DigitalOut<PinName::PB_3> led;
 
+	static constexpr char HEART_BEAT[] = "{} alive, {:.2f} s\n\r";
+	std::uint32_t count								 = 0;
+
 	while (1) {
 		constexpr auto SOME_INTERVAL = 10000000;
 		for (int i = 0; i < SOME_INTERVAL; ++i) {
 			__asm("nop");
 		}
 
-		pc << "1\n\r";
+		++count;
+		pc.print<HEART_BEAT>(count, static_cast<float>(count) * 0.5f);
 		led.toggle();
 	}
 }
@@ -45,19 +45,19 @@ using Baudrate_t = StrongType<std::uint64_t, struct Baudrate>;
  *
  * @{
  */
-constexpr auto operator"" _Baud(std::uint64_t t_baud) noexcept { return Baudrate_t{t_baud}; }
+constexpr auto operator"" _Baud(unsigned long long t_baud) noexcept { return Baudrate_t{t_baud}; }
 
 constexpr auto operator"" _KBaud(long double t_baud) noexcept {
 	return Baudrate_t{static_cast<std::uint64_t>(t_baud) * 1000ULL};
 }
 
-constexpr auto operator"" _KBaud(std::uint64_t t_baud) noexcept { return Baudrate_t{t_baud * 1000ULL}; }
+constexpr auto operator"" _KBaud(unsigned long long t_baud) noexcept { return Baudrate_t{t_baud * 1000ULL}; }
 
 constexpr auto operator"" _MBaud(long double t_baud) noexcept {
 	return Baudrate_t{static_cast<std::uint64_t>(t_baud) * 1000000ULL};
 }
 
-constexpr auto operator"" _MBaud(std::uint64_t t_baud) noexcept { return Baudrate_t{t_baud * 1000000ULL}; }
+constexpr auto operator"" _MBaud(unsigned long long t_baud) noexcept { return Baudrate_t{t_baud * 1000000ULL}; }
 
 /**@}*/
 
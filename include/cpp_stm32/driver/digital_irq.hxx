@@ -23,6 +23,7 @@
 #pragma once
 
 #include "cpp_stm32/driver/gpio_base.hxx"
+#include "cpp_stm32/driver/pin_config.hxx"
 
 #include "device.hxx"
 
@@ -32,10 +33,16 @@ namespace cpp_stm32::driver {
 template <gpio::PinName Pin>
 class DigitalIrq {
  public:
+	/**
+	 * @brief		Pins set up by constructor, see @ref BoardPinConfig
+	 */
+	using PinDecls = PinDecl<Pin, gpio::Mode::Input>;
+
 	template <auto F>
 	explicit constexpr DigitalIrq(Callback<F> const& t_cb, exti::TriggerType const t_trigger) noexcept {
 		using gpio::Mode, gpio::Pupd;
 
+		check_board_pins<PinDecls>();
 		GpioUtil<Pin>::enableAllGpioClk();
 		GpioUtil<Pin>::modeSetup(Mode::Input, Pupd::None);
 
@@ -24,6 +24,7 @@
 
 #include "cpp_stm32/common/gpio.hxx"
 #include "cpp_stm32/driver/gpio_base.hxx"
+#include "cpp_stm32/driver/pin_config.hxx"
 #include "cpp_stm32/utility/utility.hxx"
 
 #include "device.hxx"
@@ -41,12 +42,18 @@ namespace cpp_stm32::driver {
 template <gpio::PinName... PinNames>
 class DigitalOut {
  public:
+	/**
+	 * @brief		Pins set up by constructor, see @ref BoardPinConfig
+	 */
+	using PinDecls = OutputPins<PinNames...>;
+
 	/**
 	 * @brief  Default constructor, it enables rcc peripheral clock, and setup gpio mode to output, no pull
 	 */
 	constexpr DigitalOut() noexcept {
 		using gpio::Mode, gpio::Pupd;
 
+		check_board_pins<PinDecls>();
 		GpioUtil<PinNames...>::enableAllGpioClk();
 		GpioUtil<PinNames...>::modeSetup(Mode::Output, Pupd::None);
 	}
@@ -0,0 +1,237 @@
+/**
+ * @file  driver/dma_double_buffer.hxx
+ * @brief	Double buffer (ping-pong) DMA streaming
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "cpp_stm32/hal/callback.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+#include "dma.hxx"
+#include "nvic.hxx"
+#include "pin_map/dma.hxx"
+
+namespace cpp_stm32::driver {
+
+/**
+ * @class 	DmaDoubleBuffer
+ * @brief		Peripheral to memory or memory to peripheral stream in double buffer mode, DMA switches between two buffers
+ * 					of N elements without stopping, while the application processes (or refills) the idle one, and is free
+ * 					to replace the idle one by another buffer.
+ * @tparam	DMA 	@ref dma::Port
+ * @tparam	Str 	@ref dma::Stream
+ * @tparam	Dir 	@ref dma::TransferMode, memory to memory is not allowed in double buffer mode
+ * @tparam	N			Number of element in each buffer
+ * @tparam	T 		Data type, std::uint8_t, std::uint16_t or std::uint32_t, same for peripheral and memory
+ *
+ * @code{.cpp}
+ * 	void on_complete(std::uint8_t const t_idx, Span<std::uint16_t> const t_buf) noexcept {
+ * 		process(t_buf);		// DMA is filling the other buffer meanwhile
+ * 	}
+ *
+ * 	DmaDoubleBuffer<Port::DMA2, Stream::Stream0, TransferMode::PeriphToMem, 256, std::uint16_t> adc_stream;
+ * 	adc_stream.start(PeriphAddress_t{ADC_DR}, Channel::Channel0, ping.data(), pong.data(), &on_complete);
+ *
+ * 	// or without handler, poll in main loop
+ * 	if (adc_stream.takeCompleted()) {
+ * 		process(adc_stream.buffer(adc_stream.completedIdx()));
+ * 	}
+ * @endcode
+ *
+ * @note 		On transfer error, e.g. the address of current target is written, hardware disables the stream, the
+ * 					handler isn't called, and @ref failed returns true, call @ref start again to restart streaming.
+ */
+template <dma::Port DMA, dma::Stream Str, dma::TransferMode Dir, std::size_t N, typename T = std::uint8_t>
+class DmaDoubleBuffer {
+ public:
+	/**
+	 * @brief		Called in DMA interrupt when a buffer is completed, i.e. DMA switched to the other buffer
+	 * @param		t_idx 	Index of completed buffer, 0 for M0 and 1 for M1
+	 * @param		t_buf 	Completed buffer, the one that is safe to access now
+	 */
+	using CompleteHandler = void (*)(std::uint8_t const t_idx, Span<T> const t_buf) noexcept;
+
+ private:
+	static_assert(Dir != dma::TransferMode::MemToMem);
+	static_assert(0 < N && N <= 0xFFFFU, "NDTR is 16 bit");
+	static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4);
+
+	static constexpr auto DATA_SIZE = sizeof(T) == 1 ? dma::DataSize::Byte
+																									 : (sizeof(T) == 2 ? dma::DataSize::HalfWord : dma::DataSize::Word);
+	static constexpr auto IRQ_NUM = dma::IrqMap::template getIrqNum<DMA, Str>();
+
+	// slot is replaced by application and read by DMA interrupt, pointer is accessed by single ldr/str
+	std::array<std::atomic<T*>, 2> m_buffer{};
+	CompleteHandler m_onComplete{nullptr};
+	std::atomic<bool> m_error{false};
+
+	static constexpr auto toAddress(T* const t_buf) noexcept {
+		return dma::MemoryAddress_t{reinterpret_cast<std::uintptr_t>(t_buf)};
+	}
+
+	void irqHandler() noexcept {
+		using dma::InterruptFlag;
+
+		auto const [tc_flag, te_flag] = dma::get_interrupt_flag<DMA, Str, InterruptFlag::TCI, InterruptFlag::TEI>();
+		if (tc_flag == 0 && te_flag == 0) {
+			return;
+		}
+
+		dma::clear_interrupt_flag<DMA, Str, InterruptFlag::TCI, InterruptFlag::TEI>();
+
+		// stream is disabled by hardware, the buffer that was being transferred is incomplete
+		if (te_flag != 0) {
+			m_error.store(true, std::memory_order_relaxed);
+			return;
+		}
+
+		auto const idx = completedIdx();
+		m_onComplete(idx, buffer(idx));
+	}
+
+ public:
+	constexpr DmaDoubleBuffer() noexcept = default;
+
+	// DMA interrupt keeps the address of this object
+	DmaDoubleBuffer(DmaDoubleBuffer const&) = delete;
+	DmaDoubleBuffer& operator=(DmaDoubleBuffer const&) = delete;
+
+	/**
+	 * @brief		This function starts streaming from M0, the DMA clock must be enabled
+	 * @param 	t_periph 			Address of peripheral data register
+	 * @param 	t_ch 					DMA request channel of the peripheral
+	 * @param 	t_buf0 				Buffer of N elements, M0
+	 * @param 	t_buf1 				Buffer of N elements, M1
+	 * @param 	t_on_complete Handler called in DMA interrupt, nullptr to poll @ref takeCompleted instead
+	 * @param 	t_prior 			Stream priority
+	 */
+	void start(dma::PeriphAddress_t const t_periph, dma::Channel const t_ch, T* const t_buf0, T* const t_buf1,
+						 CompleteHandler const t_on_complete = nullptr,
+						 dma::StreamPriority const t_prior	 = dma::StreamPriority::High) noexcept {
+		m_buffer[0].store(t_buf0, std::memory_order_relaxed);
+		m_buffer[1].store(t_buf1, std::memory_order_relaxed);
+		m_onComplete = t_on_complete;
+		m_error.store(false, std::memory_order_relaxed);
+
+		auto builder = dma::DmaBuilder<DMA, Str>{}
+										 .txDataNum(static_cast<std::uint16_t>(N))
+										 .selectChannel(t_ch)
+										 .streamPriority(t_prior)
+										 .enableMemIncrement()
+										 .memoryDataWidth(DATA_SIZE)
+										 .perihperalDataWidth(DATA_SIZE)
+										 .doubleBufferTarget(0);
+
+		if constexpr (Dir == dma::TransferMode::PeriphToMem) {
+			builder = builder.transferDir(t_periph, toAddress(t_buf0));
+		} else {
+			builder = builder.transferDir(toAddress(t_buf0), t_periph);
+		}
+
+		dma::set_address<DMA, Str>(toAddress(t_buf0), toAddress(t_buf1));
+
+		if (t_on_complete != nullptr) {
+			nvic::enable_irq<IRQ_NUM>(Callback<&DmaDoubleBuffer::irqHandler>{this});
+			builder.template enableInterrupt<dma::InterruptFlag::TCI, dma::InterruptFlag::TEI>().build();
+		} else {
+			builder.build();
+		}
+	}
+
+	/**
+	 * @brief		This function stops streaming
+	 */
+	void stop() const noexcept { dma::disable<DMA, Str>(); }
+
+	/**
+	 * @brief		This function returns the index of the buffer that DMA is not accessing, i.e. the completed one
+	 * @note 		This doesn't tell whether the buffer has completed since last call, see @ref takeCompleted
+	 */
+	[[nodiscard]] std::uint8_t completedIdx() const noexcept {
+		return static_cast<std::uint8_t>(dma::double_buffer_get_target<DMA, Str>() ^ 1U);
+	}
+
+	/**
+	 * @brief		This function returns and clears transfer complete flag, if it is set, the buffer of @ref completedIdx is
+	 * 					newly completed and safe to access
+	 * @note 		Only for polling, i.e. without completion handler, otherwise the flag is taken by DMA interrupt and this
+	 * 					function always returns false. The flag doesn't count, a buffer is lost if it is polled slower than
+	 * 					the transfer of N elements.
+	 */
+	[[nodiscard]] bool takeCompleted() noexcept {
+		if (m_onComplete == nullptr) {
+			if (auto const [tc_flag] = dma::get_interrupt_flag<DMA, Str, dma::InterruptFlag::TCI>(); tc_flag != 0) {
+				dma::clear_interrupt_flag<DMA, Str, dma::InterruptFlag::TCI>();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief		This function returns and clears transfer error status, the stream is stopped if it is set
+	 * @note 		Without completion handler, the status is read from the transfer error flag
+	 */
+	[[nodiscard]] bool failed() noexcept {
+		if (m_onComplete == nullptr) {
+			if (auto const [te_flag] = dma::get_interrupt_flag<DMA, Str, dma::InterruptFlag::TEI>(); te_flag != 0) {
+				dma::clear_interrupt_flag<DMA, Str, dma::InterruptFlag::TEI>();
+				return true;
+			}
+		}
+
+		return m_error.exchange(false, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief		This function returns the buffer
+	 * @param 	t_idx 	0 for M0 and 1 for M1
+	 */
+	[[nodiscard]] auto buffer(std::uint8_t const t_idx) const noexcept {
+		return Span<T>{m_buffer[t_idx].load(std::memory_order_relaxed), N};
+	}
+
+	/**
+	 * @brief		This function replaces the buffer that DMA is not accessing, DMA switches to it on next completion
+	 * @param 	t_buf 	Buffer of N elements
+	 *
+	 * @note 		See @ref dma::double_buffer_set_idle_address for the timing constraint
+	 */
+	void setIdleBuffer(T* const t_buf) noexcept {
+		auto const idle_idx = completedIdx();
+		m_buffer[idle_idx].store(t_buf, std::memory_order_relaxed);
+
+		// same as dma::double_buffer_set_idle_address, without reading CT again
+		if (idle_idx == 0) {
+			dma::reg::SxM0AR<DMA, Str>.template writeBit<dma::reg::SxM0ARField::M0A>(toAddress(t_buf).get());
+		} else {
+			dma::reg::SxM1AR<DMA, Str>.template writeBit<dma::reg::SxM1ARField::M1A>(toAddress(t_buf).get());
+		}
+	}
+};
+
+}	// namespace cpp_stm32::driver
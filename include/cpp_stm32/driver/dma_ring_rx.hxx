@@ -0,0 +1,155 @@
+/**
+ * @file  driver/dma_ring_rx.hxx
+ * @brief	Circular DMA receive buffer, consumed in place
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "cpp_stm32/utility/span.hxx"
+
+#include "dma.hxx"
+
+namespace cpp_stm32::driver {
+
+/**
+ * @class 	DmaRingRx
+ * @brief		Peripheral to memory DMA in circular mode, the received data is handed to consumer as (at most) two
+ * 					contiguous spans over the DMA buffer, i.e. no copy, and no lock, since DMA is the only producer.
+ * @tparam	DMA 	@ref dma::Port
+ * @tparam	Str 	@ref dma::Stream
+ * @tparam	N			Number of element in the buffer
+ * @tparam	T 		Data type, std::uint8_t, std::uint16_t or std::uint32_t, same for peripheral and memory
+ *
+ * @code{.cpp}
+ * 	DmaRingRx<Port::DMA1, Stream::Stream5, 64> rx;
+ * 	rx.start(PeriphAddress_t{usart::reg::DR<Usart2>.memoryAddr()}, Channel::Channel4);
+ * 	usart::enable_rx_dma<Usart2>();
+ *
+ * 	auto const [first, second] = rx.peek();
+ * 	parse(first), parse(second);
+ * 	rx.consume(first.size() + second.size());
+ * @endcode
+ *
+ * @note 		Write position is derived from NDTR, so the buffer can't tell full from empty, and data is silently
+ * 					overwritten if the consumer falls behind more than N - 1 elements. Size the buffer for the worst case
+ * 					latency of consumer, or count HT/TC interrupts to detect overrun.
+ */
+template <dma::Port DMA, dma::Stream Str, std::size_t N, typename T = std::uint8_t>
+class DmaRingRx {
+ private:
+	static_assert(1 < N && N <= 0xFFFFU, "NDTR is 16 bit");
+	static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4);
+
+	static constexpr auto DATA_SIZE = sizeof(T) == 1 ? dma::DataSize::Byte
+																									 : (sizeof(T) == 2 ? dma::DataSize::HalfWord : dma::DataSize::Word);
+
+	std::array<T, N> m_buffer{};
+	std::size_t m_readPos{0};
+
+	/**
+	 * @brief		This function returns the index DMA is going to write next
+	 */
+	[[nodiscard]] auto writePos() const noexcept {
+		auto const remain = static_cast<std::size_t>(dma::get_tx_data_num<DMA, Str>());
+
+		// data before the position is written by DMA, don't let compiler read the buffer before NDTR
+		std::atomic_signal_fence(std::memory_order_acquire);
+		return (N - remain) % N;
+	}
+
+ public:
+	constexpr DmaRingRx() noexcept = default;
+
+	// DMA keeps the address of the buffer
+	DmaRingRx(DmaRingRx const&) = delete;
+	DmaRingRx& operator=(DmaRingRx const&) = delete;
+
+	/**
+	 * @brief		This function starts circular reception, the DMA clock must be enabled
+	 * @tparam	Flags 		Interrupt to be enabled, e.g. HTI and TCI to wake up the consumer
+	 * @param 	t_periph 	Address of peripheral data register
+	 * @param 	t_ch 			DMA request channel of the peripheral
+	 * @param 	t_prior 	Stream priority
+	 */
+	template <dma::InterruptFlag... Flags>
+	void start(dma::PeriphAddress_t const t_periph, dma::Channel const t_ch,
+						 dma::StreamPriority const t_prior = dma::StreamPriority::Low) noexcept {
+		m_readPos = 0;
+
+		dma::DmaBuilder<DMA, Str>{}
+			.transferDir(t_periph, dma::MemoryAddress_t{reinterpret_cast<std::uintptr_t>(m_buffer.data())})
+			.txDataNum(static_cast<std::uint16_t>(N))
+			.selectChannel(t_ch)
+			.streamPriority(t_prior)
+			.enableMemIncrement()
+			.memoryDataWidth(DATA_SIZE)
+			.perihperalDataWidth(DATA_SIZE)
+			.useCircularMode()
+			.template enableInterrupt<Flags...>()
+			.build();
+	}
+
+	/**
+	 * @brief		This function stops reception, data that is not consumed yet is kept
+	 */
+	void stop() const noexcept { dma::disable<DMA, Str>(); }
+
+	/**
+	 * @brief		This function returns number of element received but not consumed yet
+	 */
+	[[nodiscard]] auto size() const noexcept { return (writePos() + N - m_readPos) % N; }
+
+	[[nodiscard]] auto empty() const noexcept { return writePos() == m_readPos; }
+
+	/**
+	 * @brief		This function returns the data received but not consumed yet, without copying
+	 * @return	std::pair of spans, the second one is non-empty only if the data wraps around the end of buffer
+	 *
+	 * @note 		The spans stay valid until they are consumed, or until DMA laps the buffer
+	 */
+	[[nodiscard]] auto peek() const noexcept {
+		auto const* const head = m_buffer.data();
+
+		auto const write_pos = writePos();
+
+		if (m_readPos <= write_pos) {
+			return std::pair{Span<T const>{head + m_readPos, head + write_pos}, Span<T const>{}};
+		}
+
+		return std::pair{Span<T const>{head + m_readPos, head + N}, Span<T const>{head, head + write_pos}};
+	}
+
+	/**
+	 * @brief		This function advances the read position past the element, it doesn't hold DMA back in any way
+	 * @param 	t_num 	Number of element to be released, no more than @ref size
+	 *
+	 * @note 		Circular DMA overwrites the buffer whether or not the element is consumed, the reader must keep up within
+	 * 					N elements, see the note of @ref DmaRingRx
+	 */
+	void consume(std::size_t const t_num) noexcept { m_readPos = (m_readPos + t_num) % N; }
+};
+
+}	// namespace cpp_stm32::driver
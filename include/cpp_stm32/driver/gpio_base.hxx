@@ -273,6 +273,52 @@ class GpioUtil {
 		(alternateFuncSteupThruPin(size_c<Idx>{}, GpioGroupTupIdxSeq<Idx>, t_af), ...);
 	}
 
+	/**
+	 * @brief    This function handles the setup of output speed, for implementation detail, see @ref modeSetupIdxThruPin
+	 * @param    t_ospeed  @ref gpio::OutputSpeed
+	 */
+	template <std::size_t Num, std::size_t... Idx>
+	static constexpr void outputSpeedSetupThruPin(size_c<Num> const /*unused*/,
+																								std::index_sequence<Idx...> const /*unused*/,
+																								gpio::OutputSpeed const t_ospeed) noexcept {
+		constexpr auto gpio_port			= PinGrouper::getPort(size_c<Num>{});
+		constexpr auto gpio_pin_group = std::get<Num>(PinGrouper::GPIO_GROUP_LIST);
+		gpio::set_output_speed<gpio_port, std::get<Idx>(gpio_pin_group)...>(t_ospeed);
+	}
+
+	/**
+	 * @brief    This function handles the setup of output speed, for implementation detail, see @ref modeSetupIdxThruPort
+	 * @param    t_ospeed  @ref gpio::OutputSpeed
+	 */
+	template <std::size_t... Idx>
+	static constexpr void outputSpeedSetupThruPort(std::index_sequence<Idx...> const /*unused*/,
+																								 gpio::OutputSpeed const t_ospeed) noexcept {
+		(outputSpeedSetupThruPin(size_c<Idx>{}, GpioGroupTupIdxSeq<Idx>, t_ospeed), ...);
+	}
+
+	/**
+	 * @brief    This function handles the setup of output type, for implementation detail, see @ref modeSetupIdxThruPort
+	 * @param    t_otype  @ref gpio::OutputType
+	 */
+	template <std::size_t Num, std::size_t... Idx>
+	static constexpr void outputTypeSetupThruPin(size_c<Num> const /*unused*/,
+																							 std::index_sequence<Idx...> const /*unused*/,
+																							 gpio::OutputType const t_otype) noexcept {
+		constexpr auto gpio_port			= PinGrouper::getPort(size_c<Num>{});
+		constexpr auto gpio_pin_group = std::get<Num>(PinGrouper::GPIO_GROUP_LIST);
+		gpio::set_output_type<gpio_port, std::get<Idx>(gpio_pin_group)...>(t_otype);
+	}
+
+	/**
+	 * @brief    This function handles the setup of output type, for implementation detail, see @ref modeSetupIdxThruPort
+	 * @param    t_otype  @ref gpio::OutputType
+	 */
+	template <std::size_t... Idx>
+	static constexpr void outputTypeSetupThruPort(std::index_sequence<Idx...> const /*unused*/,
+																								gpio::OutputType const t_otype) noexcept {
+		(outputTypeSetupThruPin(size_c<Idx>{}, GpioGroupTupIdxSeq<Idx>, t_otype), ...);
+	}
+
 	/**
 	 * [setThruPin description]
 	 * @param t_sc  [description]
@@ -318,8 +364,13 @@ class GpioUtil {
  public:
 	/**
 	 * @brief  This function is the public interface of enabling RCC gpio clock according to input pin names
+	 * @note   This and other setup functions do nothing if BOARD_PIN_CONFIG is set, see @ref BoardPinConfig
 	 */
-	static constexpr void enableAllGpioClk() noexcept { enableAllGpioClkImp(IdxThruPort{}); }
+	static constexpr void enableAllGpioClk() noexcept {
+		if constexpr (!BOARD_PIN_CONFIG) {
+			enableAllGpioClkImp(IdxThruPort{});
+		}
+	}
 
 	/**
 	 * @brief  This function is the public interface of gpio mode setup
@@ -327,7 +378,9 @@ class GpioUtil {
 	 * @param t_pupd @ref gpio::Pupd
 	 */
 	static constexpr void modeSetup(gpio::Mode const& t_mode, gpio::Pupd const& t_pupd) noexcept {
-		modeSetupIdxThruPort(IdxThruPort{}, t_mode, t_pupd);
+		if constexpr (!BOARD_PIN_CONFIG) {
+			modeSetupIdxThruPort(IdxThruPort{}, t_mode, t_pupd);
+		}
 	}
 
 	/**
@@ -340,7 +393,29 @@ class GpioUtil {
 	 * @param  t_af  @ref gpio::AltFunc
 	 */
 	static constexpr void alternateFuncSetup(gpio::AltFunc const& t_af) noexcept {
-		alternateFuncSetupThruPort(IdxThruPort{}, t_af);
+		if constexpr (!BOARD_PIN_CONFIG) {
+			alternateFuncSetupThruPort(IdxThruPort{}, t_af);
+		}
+	}
+
+	/**
+	 * @brief  This function is the public interface of gpio set output speed
+	 * @param  t_ospeed  @ref gpio::OutputSpeed
+	 */
+	static constexpr void outputSpeedSetup(gpio::OutputSpeed const t_ospeed) noexcept {
+		if constexpr (!BOARD_PIN_CONFIG) {
+			outputSpeedSetupThruPort(IdxThruPort{}, t_ospeed);
+		}
+	}
+
+	/**
+	 * @brief  This function is the public interface of gpio set output type
+	 * @param  t_otype  @ref gpio::OutputType
+	 */
+	static constexpr void outputTypeSetup(gpio::OutputType const t_otype) noexcept {
+		if constexpr (!BOARD_PIN_CONFIG) {
+			outputTypeSetupThruPort(IdxThruPort{}, t_otype);
+		}
 	}
 
 	/**
@@ -27,6 +27,7 @@
 #include <iterator>
 
 #include "cpp_stm32/driver/gpio_base.hxx"
+#include "cpp_stm32/driver/pin_config.hxx"
 #include "cpp_stm32/utility/serial.hxx"
 
 #include "device.hxx"
@@ -64,11 +65,19 @@ class I2C {
 	static_assert(I2cSDA<SDA>::PORT == I2cSCL<SCL>::PORT);
 
  public:
+	/**
+	 * @brief		Pins set up by constructor, see @ref BoardPinConfig, the bus is open drain as required by reference manual
+	 */
+	using PinDecls = PinDeclList<PinDecl<SDA, gpio::Mode::AltFunc, gpio::Pupd::PullUp, AF, gpio::OutputType::OpenDrain>,
+															 PinDecl<SCL, gpio::Mode::AltFunc, gpio::Pupd::PullUp, AF, gpio::OutputType::OpenDrain>>;
+
 	explicit constexpr I2C(I2cSDA<SDA> const /*unused*/, I2cSCL<SCL> const /*unused*/,
 												 Frequency<Hz> const t_freq) noexcept {
+		check_board_pins<PinDecls>();
 		GpioUtil<SDA, SCL>::enableAllGpioClk();
-		GpioUtil<SDA, SCL>::modeSetup(gpio::Mode::AltFunc, gpio::Pupd::PullUp);
+		GpioUtil<SDA, SCL>::outputTypeSetup(gpio::OutputType::OpenDrain);
 		GpioUtil<SDA, SCL>::alternateFuncSetup(AF);
+		GpioUtil<SDA, SCL>::modeSetup(gpio::Mode::AltFunc, gpio::Pupd::PullUp);
 
 		i2c::reset<PORT>();
 		rcc::enable_periph_clk<RCC>();
@@ -0,0 +1,458 @@
+/**
+ * @file  driver/i2c_async.hxx
+ * @brief	Interrupt driven I2C master
+ *
+ * @ref   RM0390, I2C master mode
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "cpp_stm32/driver/i2c.hxx"
+#include "cpp_stm32/hal/callback.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+#include "dma.hxx"
+#include "nvic.hxx"
+#include "pin_map/dma.hxx"
+
+namespace cpp_stm32::driver {
+
+using I2cAsyncCallback = void (*)() noexcept;
+
+/**
+ * @brief		DMA stream of I2C RX request, selects DMA reception of @ref I2cAsync
+ */
+template <dma::Port DMA, dma::Stream Str>
+struct I2cRxDma {
+	static constexpr auto PORT	 = DMA;
+	static constexpr auto STREAM = Str;
+};
+
+/**
+ * @class 	I2cAsync
+ * @brief		I2C master run by event and error interrupts, each step of the transaction (start, address, every byte, stop)
+ * 					is taken in interrupt, the CPU is free while the bus works. Blocking API of @ref I2C is still available,
+ * 					but must not be used while an asynchronous transaction is ongoing.
+ * @tparam	RxDma 	void, or @ref I2cRxDma to receive 2 or more bytes by DMA, the last byte is NACKed by hardware (LAST bit)
+ * 									and the transaction completes from DMA transfer complete interrupt, so that there is no
+ * 									interrupt per byte
+ *
+ * @code{.cpp}
+ * 	I2cAsync imu{I2cSDA<PinName::PB_9>{}, I2cSCL<PinName::PB_8>{}, 400_kHz};
+ * 	imu.start();
+ *
+ * 	std::array<std::uint8_t, 6> gyro{};
+ * 	imu.readRegisters(i2c::SlaveAddr7_t{GYRO_ADDR}, OUT_X_L_G | AUTO_INCREMENT, Span{gyro}, &on_gyro);	// returns immediately
+ *
+ * 	// or with DMA reception
+ * 	using Streams = dma::StreamAllocator<dma::Use<dma::Request::I2c1Rx>>;
+ * 	constexpr auto RX_DMA = Streams::get<dma::Request::I2c1Rx>();
+ *
+ * 	I2cAsync imu{I2cSDA<PinName::PB_9>{}, I2cSCL<PinName::PB_8>{}, 400_kHz, I2cRxDma<RX_DMA.port, RX_DMA.stream>{}};
+ * 	imu.start(RX_DMA.channel);
+ * @endcode
+ *
+ * @note 		Buffers must stay untouched until the transaction completes. Only 7 bit slave address is supported.
+ */
+template <gpio::PinName SDA, gpio::PinName SCL, std::uint32_t Hz, typename RxDma = void>
+class I2cAsync : public I2C<SDA, SCL, Hz> {
+ private:
+	static constexpr auto PORT					 = I2cSDA<SDA>::PORT;
+	static constexpr auto EV_IRQ				 = I2cSDA<SDA>::IRQ[0];
+	static constexpr auto ER_IRQ				 = I2cSDA<SDA>::IRQ[1];
+	static constexpr auto USE_DMA				 = !std::is_void_v<RxDma>;
+	static constexpr auto MAX_DMA_LENGTH = std::size_t{0xFFFFU};	// NDTR is 16 bit
+
+	enum class State : std::uint8_t {
+		Start,		 /*!< Start condition is requested, waiting for SB and ADDR */
+		Transmit,	 /*!< Address is acknowledged, sending data */
+		Receive,	 /*!< Address is acknowledged, receiving data */
+	};
+
+	i2c::SlaveAddr7_t m_slave{0};
+	std::uint8_t const* m_tx{nullptr};
+	std::uint8_t* m_rx{nullptr};
+	std::size_t m_txLeft{0};
+	std::size_t m_rxLeft{0};
+	State m_state{State::Start};
+	bool m_read{false}; /*!< Direction of the address phase being run */
+
+	std::uint8_t m_register{0}; /*!< Register address written by @ref readRegisters */
+
+	I2cAsyncCallback m_onComplete{nullptr};
+	std::atomic<bool> m_busy{false};
+	std::atomic<bool> m_error{false};
+
+	dma::Channel m_dmaChannel{dma::Channel::Channel0};
+	dma::StreamPriority m_dmaPrior{dma::StreamPriority::High};
+
+	static void enableBufferIrq() noexcept { i2c::reg::CR2<PORT>.template setBit<i2c::reg::CR2Field::ITBUFEN>(); }
+
+	static void disableBufferIrq() noexcept { i2c::reg::CR2<PORT>.template clearBit<i2c::reg::CR2Field::ITBUFEN>(); }
+
+	/**
+	 * @brief		ADDR is cleared by reading SR1 followed by SR2, SR1 is read by event handler already
+	 */
+	static void clearAddress() noexcept { [[gnu::unused]] auto const [busy] = i2c::get_status<PORT, i2c::Status::BUSY>(); }
+
+	void readByte() noexcept {
+		*m_rx++ = std::get<0>(i2c::reg::DR<PORT>.template readBit<i2c::reg::DRField::DR>(ValueOnly));
+		--m_rxLeft;
+	}
+
+	void finish(bool const t_error) noexcept {
+		i2c::disable_irq<PORT, i2c::InterruptFlag::TxE>();	// ITEVTEN and ITBUFEN
+		i2c::disable_irq<PORT, i2c::InterruptFlag::AF>();		// ITERREN
+		i2c::clear_2nd_byte_ack<PORT>();
+
+		if constexpr (USE_DMA) {
+			i2c::disable_dma<PORT>();
+			i2c::clear_dma_last_transfer<PORT>();
+		}
+
+		m_error.store(t_error, std::memory_order_relaxed);
+		m_busy.store(false, std::memory_order_release);
+
+		if (m_onComplete != nullptr) {
+			m_onComplete();
+		}
+	}
+
+	/**
+	 * @brief		This function prepares the data phase, the number of byte to receive decides when ACK is cleared and STOP
+	 * 					is set, so that the slave is NACKed exactly at the last byte
+	 */
+	void onAddressSent() noexcept {
+		if (!m_read) {
+			m_state = State::Transmit;
+			clearAddress();
+			enableBufferIrq();
+			return;
+		}
+
+		m_state = State::Receive;
+
+		if constexpr (USE_DMA) {
+			if (m_rxLeft >= 2) {
+				startRxDma();
+				return;
+			}
+		}
+
+		if (m_rxLeft == 1) {
+			// ACK is cleared before ADDR is cleared, and STOP is set right after
+			i2c::disable_ack<PORT>();
+			clearAddress();
+			i2c::generate_stop_condition<PORT>();
+			enableBufferIrq();
+		} else if (m_rxLeft == 2) {
+			// NACK goes with the byte in shift register, both are read once BTF is set
+			i2c::set_2nd_byte_ack<PORT>();
+			i2c::disable_ack<PORT>();
+			clearAddress();
+			disableBufferIrq();
+		} else {
+			clearAddress();
+			enableBufferIrq();
+		}
+	}
+
+	/**
+	 * @brief		This function hands the data phase over to DMA, ADDR must not be cleared yet
+	 */
+	void startRxDma() noexcept {
+		using dma::InterruptFlag;
+
+		dma::DmaBuilder<RxDma::PORT, RxDma::STREAM>{}
+			.transferDir(dma::PeriphAddress_t{i2c::reg::DR<PORT>.memoryAddr()},
+									 dma::MemoryAddress_t{reinterpret_cast<std::uintptr_t>(m_rx)})
+			.txDataNum(static_cast<std::uint16_t>(m_rxLeft))
+			.selectChannel(m_dmaChannel)
+			.streamPriority(m_dmaPrior)
+			.enableMemIncrement()
+			.template enableInterrupt<InterruptFlag::TCI, InterruptFlag::TEI>()
+			.build();
+
+		// NACK goes with the byte of the last DMA request, ACK stays enabled for the rest
+		i2c::set_dma_last_transfer<PORT>();
+		i2c::enable_dma<PORT>();
+
+		// only error interrupt is needed until DMA completes
+		i2c::disable_irq<PORT, i2c::InterruptFlag::TxE>();
+		clearAddress();
+	}
+
+	void dmaHandler() noexcept {
+		using dma::InterruptFlag;
+
+		auto const [tc_flag, te_flag] =
+			dma::get_interrupt_flag<RxDma::PORT, RxDma::STREAM, InterruptFlag::TCI, InterruptFlag::TEI>();
+		if (tc_flag == 0 && te_flag == 0) {
+			return;
+		}
+
+		dma::clear_interrupt_flag<RxDma::PORT, RxDma::STREAM, InterruptFlag::TCI, InterruptFlag::TEI>();
+
+		if (te_flag != 0) {
+			dma::disable<RxDma::PORT, RxDma::STREAM>();
+		}
+
+		i2c::generate_stop_condition<PORT>();
+		m_rxLeft = 0;
+		finish(te_flag != 0);
+	}
+
+	void onTransmit(bool const t_txe, bool const t_btf) noexcept {
+		if (m_txLeft != 0) {
+			if (t_txe) {
+				i2c::reg::DR<PORT>.template writeBit<i2c::reg::DRField::DR>(*m_tx++);
+
+				// the next event is BTF of the last byte
+				if (--m_txLeft == 0) {
+					disableBufferIrq();
+				}
+			}
+
+			return;
+		}
+
+		if (!t_btf) {
+			return;
+		}
+
+		if (m_rxLeft != 0) {
+			m_state = State::Start;
+			m_read	= true;
+			i2c::enable_ack<PORT>();
+			i2c::generate_start_condition<PORT>();
+		} else {
+			i2c::generate_stop_condition<PORT>();
+			finish(false);
+		}
+	}
+
+	/**
+	 * @brief		Last 3 bytes are read at BTF, i.e. with SCL stretched, so that ACK and STOP are changed in time
+	 */
+	void onReceive(bool const t_rxne, bool const t_btf) noexcept {
+		if (t_btf && m_rxLeft <= 3) {
+			if (m_rxLeft == 3) {
+				// data N-2 in DR, data N-1 in shift register
+				i2c::disable_ack<PORT>();
+				readByte();
+			} else {
+				// data N-1 in DR, data N in shift register
+				i2c::generate_stop_condition<PORT>();
+				readByte();
+				readByte();
+				finish(false);
+			}
+		} else if (t_rxne) {
+			if (m_rxLeft == 1) {
+				readByte();
+				finish(false);
+			} else if (m_rxLeft > 3) {
+				readByte();
+			} else {
+				disableBufferIrq();
+			}
+		}
+	}
+
+	void eventHandler() noexcept {
+		using i2c::InterruptFlag;
+
+		auto const [sb, addr, btf, rxne, txe] = i2c::get_interrupt_flag<PORT, InterruptFlag::SB, InterruptFlag::ADDR,
+																																		InterruptFlag::BTF, InterruptFlag::RxNE, InterruptFlag::TxE>();
+
+		if (sb != 0) {
+			// SB is cleared by reading SR1 followed by writing DR
+			i2c::send_slave_address<PORT>(m_slave, m_read ? i2c::Command::Read : i2c::Command::Write);
+		} else if (addr != 0) {
+			onAddressSent();
+		} else if (m_state == State::Transmit) {
+			onTransmit(txe != 0, btf != 0);
+		} else if (m_state == State::Receive) {
+			onReceive(rxne != 0, btf != 0);
+		}
+	}
+
+	void errorHandler() noexcept {
+		using i2c::InterruptFlag;
+
+		auto const [berr, arlo, af, ovr] =
+			i2c::get_interrupt_flag<PORT, InterruptFlag::BERR, InterruptFlag::ARLO, InterruptFlag::AF, InterruptFlag::OVR>();
+		if (berr == 0 && arlo == 0 && af == 0 && ovr == 0) {
+			return;
+		}
+
+		i2c::clear_status<PORT, InterruptFlag::BERR, InterruptFlag::ARLO, InterruptFlag::AF, InterruptFlag::OVR>();
+
+		// interface switches to slave mode when arbitration is lost, otherwise the bus is released by master
+		if (arlo == 0) {
+			i2c::generate_stop_condition<PORT>();
+		}
+
+		if constexpr (USE_DMA) {
+			dma::disable<RxDma::PORT, RxDma::STREAM>();
+		}
+
+		finish(true);
+	}
+
+ public:
+	explicit constexpr I2cAsync(I2cSDA<SDA> const t_sda, I2cSCL<SCL> const t_scl, Frequency<Hz> const t_freq) noexcept
+		: I2C<SDA, SCL, Hz>(t_sda, t_scl, t_freq) {}
+
+	template <typename Dma, typename = std::enable_if_t<std::is_same_v<Dma, RxDma>>>
+	explicit constexpr I2cAsync(I2cSDA<SDA> const t_sda, I2cSCL<SCL> const t_scl, Frequency<Hz> const t_freq,
+															Dma const /**/) noexcept
+		: I2C<SDA, SCL, Hz>(t_sda, t_scl, t_freq) {}
+
+	// I2C interrupts keep the address of this object
+	I2cAsync(I2cAsync const&) = delete;
+	I2cAsync& operator=(I2cAsync const&) = delete;
+
+	/**
+	 * @brief		This function attaches I2C event and error interrupts
+	 */
+	void start() noexcept {
+		static_assert(!USE_DMA, "DMA request channel is required");
+
+		nvic::enable_irq<EV_IRQ>(Callback<&I2cAsync::eventHandler>{this});
+		nvic::enable_irq<ER_IRQ>(Callback<&I2cAsync::errorHandler>{this});
+	}
+
+	/**
+	 * @brief		This function attaches I2C event, error and DMA interrupts
+	 * @param 	t_ch 			DMA request channel of I2C RX
+	 * @param 	t_prior 	Stream priority
+	 */
+	void start(dma::Channel const t_ch, dma::StreamPriority const t_prior = dma::StreamPriority::High) noexcept {
+		static_assert(USE_DMA);
+
+		m_dmaChannel = t_ch;
+		m_dmaPrior	 = t_prior;
+
+		constexpr auto DMA_IRQ = dma::IrqMap::template getIrqNum<RxDma::PORT, RxDma::STREAM>();
+		nvic::enable_irq<DMA_IRQ>(Callback<&I2cAsync::dmaHandler>{this});
+		nvic::enable_irq<EV_IRQ>(Callback<&I2cAsync::eventHandler>{this});
+		nvic::enable_irq<ER_IRQ>(Callback<&I2cAsync::errorHandler>{this});
+	}
+
+	/**
+	 * @brief		This function starts write, read, or write then repeated start read transaction, and returns without
+	 * 					waiting
+	 * @param 	t_slave 	Slave address
+	 * @param 	t_tx 			Data to write, or empty for read only transaction
+	 * @param 	t_rx 			Buffer of data to read, or empty for write only transaction
+	 * @param 	t_cb 			Called in I2C interrupt when the transaction completes, or nullptr to poll @ref done instead
+	 * @return	false if a transaction is ongoing, both are empty, or DMA reception exceeds 65535 bytes, nothing is
+	 * 					started
+	 *
+	 * @note 		Stop condition of the previous transaction may still be on the bus if it just completed, in which case this
+	 * 					function waits for it, which takes less than one SCL period.
+	 */
+	bool xferAsync(i2c::SlaveAddr7_t const t_slave, Span<std::uint8_t const> const t_tx, Span<std::uint8_t> const t_rx,
+								 I2cAsyncCallback const t_cb = nullptr) noexcept {
+		if ((t_tx.empty() && t_rx.empty()) || (USE_DMA && t_rx.size() > MAX_DMA_LENGTH)) {
+			return false;
+		}
+
+		if (m_busy.exchange(true, std::memory_order_acquire)) {
+			return false;
+		}
+
+		m_slave			 = t_slave;
+		m_tx				 = t_tx.data();
+		m_txLeft		 = t_tx.size();
+		m_rx				 = t_rx.data();
+		m_rxLeft		 = t_rx.size();
+		m_state			 = State::Start;
+		m_read			 = t_tx.empty();
+		m_onComplete = t_cb;
+		m_error.store(false, std::memory_order_relaxed);
+
+		i2c::wait_status<PORT, i2c::Status::BUSY>(false);
+
+		if (m_read) {
+			i2c::enable_ack<PORT>();
+		}
+
+		i2c::enable_irq<PORT, i2c::InterruptFlag::SB>();	// ITEVTEN
+		i2c::enable_irq<PORT, i2c::InterruptFlag::AF>();	// ITERREN
+		i2c::generate_start_condition<PORT>();
+
+		return true;
+	}
+
+	bool writeAsync(i2c::SlaveAddr7_t const t_slave, Span<std::uint8_t const> const t_tx,
+									I2cAsyncCallback const t_cb = nullptr) noexcept {
+		return xferAsync(t_slave, t_tx, Span<std::uint8_t>{}, t_cb);
+	}
+
+	bool readAsync(i2c::SlaveAddr7_t const t_slave, Span<std::uint8_t> const t_rx,
+								 I2cAsyncCallback const t_cb = nullptr) noexcept {
+		return xferAsync(t_slave, Span<std::uint8_t const>{}, t_rx, t_cb);
+	}
+
+	/**
+	 * @brief		This function reads consecutive registers in one transaction: register address is written, then the data
+	 * 					is read after repeated start
+	 * @param 	t_reg 	Address of the first register, including auto increment flag if the device requires one
+	 * @return	false if a transaction is ongoing, see @ref xferAsync
+	 */
+	bool readRegisters(i2c::SlaveAddr7_t const t_slave, std::uint8_t const t_reg, Span<std::uint8_t> const t_rx,
+										 I2cAsyncCallback const t_cb = nullptr) noexcept {
+		// register address is kept by this object, as it is written in interrupt
+		if (!done()) {
+			return false;
+		}
+
+		m_register = t_reg;
+		return xferAsync(t_slave, Span<std::uint8_t const>{&m_register, 1}, t_rx, t_cb);
+	}
+
+	/**
+	 * @brief		This function checks whether the last transaction is completed
+	 */
+	[[nodiscard]] bool done() const noexcept { return !m_busy.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief		This function checks whether the last transaction is stopped by bus error, arbitration lost, NACK or
+	 * 					overrun, the received data is invalid if so
+	 */
+	[[nodiscard]] bool failed() const noexcept { return m_error.load(std::memory_order_relaxed); }
+
+	void wait() const noexcept {
+		while (!done()) {
+		}
+	}
+};
+
+template <gpio::PinName SDA, gpio::PinName SCL, std::uint32_t Hz, dma::Port DMA, dma::Stream Str>
+I2cAsync(I2cSDA<SDA>, I2cSCL<SCL>, Frequency<Hz>, I2cRxDma<DMA, Str>) -> I2cAsync<SDA, SCL, Hz, I2cRxDma<DMA, Str>>;
+
+}	// namespace cpp_stm32::driver
@@ -0,0 +1,253 @@
+/**
+ * @file  driver/parallel_bus.hxx
+ * @brief	Output of N bit value on arbitrary set of GPIO pins
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "cpp_stm32/common/gpio.hxx"
+#include "cpp_stm32/driver/gpio_base.hxx"
+#include "cpp_stm32/driver/pin_config.hxx"
+#include "cpp_stm32/utility/utility.hxx"
+
+#include "device.hxx"
+
+namespace cpp_stm32::driver {
+
+/**
+ * @class 	ParallelBus
+ * @brief		This class drives N bit value onto a set of GPIO pins, e.g. data bus of parallel LCD or FPGA. Writing a value
+ * 					is one BSRR store per port, without reading ODR, so that pins of the same port change at the same time, and
+ * 					other pins of the port, e.g. driven by ISR, are untouched.
+ * @tparam	PinNames 	@ref gpio::PinName, the first one is bit 0 of the value
+ *
+ * @details	Bits are moved to pin positions by scatter table computed at compile time, one per port. Bits that are
+ * 					consecutive in both value and port form a segment, which costs a shift and a mask, e.g. PA_0 ... PA_7 as bit 0
+ * 					to 7 is one segment. If a port has more than @ref LUT_THRESHOLD segments, each byte of the value is looked up
+ * 					in a 256 entry table instead, i.e. one load per byte, at the cost of 512 byte of flash per byte.
+ *
+ * @code{.cpp}
+ * 	ParallelBus<PinName::PA_9, PinName::PC_7, PinName::PA_10, PinName::PB_3, PinName::PB_5, PinName::PB_4, PinName::PB_10,
+ * 							PinName::PA_8> const lcd_data{gpio::OutputSpeed::High};
+ *
+ * 	lcd_data.write(0x2C);	// 3 stores, to GPIOA, GPIOB and GPIOC
+ * @endcode
+ */
+template <gpio::PinName... PinNames>
+class ParallelBus {
+ private:
+	using PinGrouper	= PinGroupingHelper<PinNames...>;
+	using IdxThruPort = typename PinGrouper::IdxThruPort;
+
+	static constexpr std::size_t WIDTH					= sizeof...(PinNames);
+	static constexpr std::size_t LANE_NUM				= (WIDTH + 7U) / 8U;
+	static constexpr std::size_t LUT_THRESHOLD	= 4U;
+	static constexpr std::uint32_t BYTE_VAL_NUM = 256U;
+	static constexpr std::uint32_t BYTE_MASK		= 0xFFU;
+	static constexpr auto PIN_NAME_LIST					= std::array{PinNames...}; /*!< In the order of bit */
+
+	static_assert(WIDTH > 0U && WIDTH <= 32U, "Width of bus must be 1 to 32");
+	static_assert(
+		[]() {
+			for (std::size_t i = 0; i < WIDTH; ++i) {
+				for (std::size_t j = i + 1; j < WIDTH; ++j) {
+					if (PIN_NAME_LIST[i] == PIN_NAME_LIST[j]) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}(),
+		"Pin is used by more than one bit");
+
+	/**
+	 * @brief		Bits [src, src + len) of value are moved to pins [dst, dst + len) of port
+	 */
+	struct Segment {
+		std::uint32_t src = 0;
+		std::uint32_t dst = 0;
+		std::uint32_t len = 0;
+	};
+
+	struct ScatterTable {
+		std::array<Segment, WIDTH> segment{};
+		std::size_t segmentNum = 0;
+		std::uint32_t pinMask	 = 0; /*!< Pins of the port used by the bus */
+	};
+
+	static constexpr auto makeScatterTable(gpio::Port const t_port) noexcept {
+		ScatterTable table{};
+
+		for (std::uint32_t bit = 0; bit < WIDTH; ++bit) {
+			if (gpio::PinMap::getPort(PIN_NAME_LIST[bit]) != t_port) {
+				continue;
+			}
+
+			auto const pin = std::uint32_t{to_underlying(gpio::PinMap::getPin(PIN_NAME_LIST[bit]))};
+			table.pinMask |= (1U << pin);
+
+			if (table.segmentNum != 0) {
+				if (auto& last = table.segment[table.segmentNum - 1];
+						last.src + last.len == bit && last.dst + last.len == pin) {
+					++last.len;
+					continue;
+				}
+			}
+
+			table.segment[table.segmentNum++] = Segment{bit, pin, 1U};
+		}
+
+		return table;
+	}
+
+	template <std::size_t... Idx>
+	static constexpr auto makeScatterTableList(std::index_sequence<Idx...> const /*unused*/) noexcept {
+		return std::array{makeScatterTable(PinGrouper::getPort(size_c<Idx>{}))...};
+	}
+
+	static constexpr auto SCATTER_TABLE_LIST = makeScatterTableList(IdxThruPort{}); /*!< In the order of port */
+
+	template <std::size_t PortIdx>
+	static constexpr bool USE_LUT = (SCATTER_TABLE_LIST[PortIdx].segmentNum > LUT_THRESHOLD);
+
+	/**
+	 * @brief		This function moves bits of a segment to their pin positions, shift and mask are constant, which are
+	 * 					usually folded into single ubfx/bfi or lsl/and
+	 */
+	template <std::size_t PortIdx, std::size_t SegIdx>
+	static constexpr std::uint32_t scatterSegment(std::uint32_t const t_val) noexcept {
+		constexpr auto seg	= SCATTER_TABLE_LIST[PortIdx].segment[SegIdx];
+		constexpr auto mask = ((1U << seg.len) - 1U) << seg.dst;
+
+		if constexpr (seg.dst >= seg.src) {
+			return (t_val << (seg.dst - seg.src)) & mask;
+		} else {
+			return (t_val >> (seg.src - seg.dst)) & mask;
+		}
+	}
+
+	template <std::size_t PortIdx, std::size_t... SegIdx>
+	static constexpr std::uint32_t scatterBySegment(std::uint32_t const t_val,
+																									std::index_sequence<SegIdx...> const /*unused*/) noexcept {
+		return (0U | ... | scatterSegment<PortIdx, SegIdx>(t_val));
+	}
+
+	template <std::size_t PortIdx>
+	static constexpr std::uint32_t scatterBySegment(std::uint32_t const t_val) noexcept {
+		return scatterBySegment<PortIdx>(t_val, std::make_index_sequence<SCATTER_TABLE_LIST[PortIdx].segmentNum>{});
+	}
+
+	template <std::size_t PortIdx, std::size_t Lane>
+	static constexpr auto makeLut() noexcept {
+		std::array<std::uint16_t, BYTE_VAL_NUM> lut{};
+
+		for (std::uint32_t byte = 0; byte < BYTE_VAL_NUM; ++byte) {
+			lut[byte] = static_cast<std::uint16_t>(scatterBySegment<PortIdx>(byte << (8U * Lane)));
+		}
+
+		return lut;
+	}
+
+	template <std::size_t PortIdx, std::size_t Lane>
+	static constexpr auto LUT = makeLut<PortIdx, Lane>();
+
+	/**
+	 * @brief		This function looks up a byte of value, the table of a byte without any bit on this port is not generated
+	 */
+	template <std::size_t PortIdx, std::size_t Lane>
+	static constexpr std::uint32_t scatterLane(std::uint32_t const t_val) noexcept {
+		if constexpr (scatterBySegment<PortIdx>(BYTE_MASK << (8U * Lane)) != 0U) {
+			return LUT<PortIdx, Lane>[(t_val >> (8U * Lane)) & BYTE_MASK];
+		} else {
+			return 0U;
+		}
+	}
+
+	template <std::size_t PortIdx, std::size_t... Lane>
+	static constexpr std::uint32_t scatterByLut(std::uint32_t const t_val,
+																							std::index_sequence<Lane...> const /*unused*/) noexcept {
+		return (0U | ... | scatterLane<PortIdx, Lane>(t_val));
+	}
+
+	template <std::size_t PortIdx>
+	static constexpr void writePort(std::uint32_t const t_val) noexcept {
+		constexpr auto port			= PinGrouper::getPort(size_c<PortIdx>{});
+		constexpr auto pin_mask = SCATTER_TABLE_LIST[PortIdx].pinMask;
+
+		auto const set = [t_val]() {
+			if constexpr (USE_LUT<PortIdx>) {
+				return scatterByLut<PortIdx>(t_val, std::make_index_sequence<LANE_NUM>{});
+			} else {
+				return scatterBySegment<PortIdx>(t_val);
+			}
+		}();
+
+		gpio::set_clear<port>(static_cast<std::uint16_t>(set), static_cast<std::uint16_t>(set ^ pin_mask));
+	}
+
+	template <std::size_t... Idx>
+	static constexpr void writeThruPort(std::uint32_t const t_val, std::index_sequence<Idx...> const /*unused*/) noexcept {
+		(writePort<Idx>(t_val), ...);
+	}
+
+ public:
+	/**
+	 * @brief		Pins set up by constructor, see @ref BoardPinConfig
+	 * @tparam	OSpeed 	Output speed passed to constructor
+	 */
+	template <gpio::OutputSpeed OSpeed = gpio::OutputSpeed::Low>
+	using PinDecls = PinDeclList<PinDecl<PinNames, gpio::Mode::Output, gpio::Pupd::None, gpio::AltFunc::AF0,
+																			 gpio::OutputType::PushPull, OSpeed>...>;
+
+	/**
+	 * @brief		Construct bus, enable rcc peripheral clock, drive 0 onto the pins, then setup gpio mode to output, no pull,
+	 * 					so that the bus doesn't glitch to the value left in ODR
+	 * @param 	t_ospeed 	@ref gpio::OutputSpeed
+	 */
+	explicit constexpr ParallelBus(gpio::OutputSpeed const t_ospeed = gpio::OutputSpeed::Low) noexcept {
+		using gpio::Mode, gpio::Pupd;
+
+		// output speed is constructor argument
+		check_board_pins<PinDecls<>, false>();
+		GpioUtil<PinNames...>::enableAllGpioClk();
+		write(0U);
+		GpioUtil<PinNames...>::outputSpeedSetup(t_ospeed);
+		GpioUtil<PinNames...>::modeSetup(Mode::Output, Pupd::None);
+	}
+
+	/**
+	 * @brief		This function drives value onto the bus, bits above the width of bus are ignored
+	 * @note 		Ports are written in the order of @ref gpio::Port, pins on different ports don't change at the same time
+	 */
+	constexpr void write(std::uint32_t const t_val) const noexcept { writeThruPort(t_val, IdxThruPort{}); }
+
+	/**
+	 * @brief		This function returns the number of bit of the bus
+	 */
+	[[nodiscard]] static constexpr auto width() noexcept { return WIDTH; }
+};
+
+}	// namespace cpp_stm32::driver
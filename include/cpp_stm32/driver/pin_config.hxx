@@ -0,0 +1,289 @@
+/**
+ * @file  driver/pin_config.hxx
+ * @brief	Configuration of all pins of the board at once
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "cpp_stm32/common/gpio.hxx"
+#include "cpp_stm32/utility/utility.hxx"
+
+// target specific include
+#include "device.hxx"
+
+namespace cpp_stm32::driver {
+
+/**
+ * @brief		Setting of a pin, see @ref PinDecl
+ */
+struct PinSetting {
+	gpio::PinName name{gpio::PinName::NC};
+	gpio::Mode mode{};
+	gpio::Pupd pupd{};
+	gpio::OutputType otype{};
+	gpio::OutputSpeed ospeed{};
+	gpio::AltFunc af{};
+
+	[[nodiscard]] constexpr bool operator==(PinSetting const& t_rhs) const noexcept {
+		return name == t_rhs.name && mode == t_rhs.mode && pupd == t_rhs.pupd && otype == t_rhs.otype &&
+					 ospeed == t_rhs.ospeed && af == t_rhs.af;
+	}
+
+	[[nodiscard]] constexpr bool operator!=(PinSetting const& t_rhs) const noexcept { return !(*this == t_rhs); }
+};
+
+/**
+ * @brief		Declaration of a pin, @ref gpio::PinName::NC is ignored
+ */
+template <gpio::PinName Name, gpio::Mode PinMode, gpio::Pupd PUPD = gpio::Pupd::None,
+					gpio::AltFunc AF = gpio::AltFunc::AF0, gpio::OutputType OType = gpio::OutputType::PushPull,
+					gpio::OutputSpeed OSpeed = gpio::OutputSpeed::Low>
+struct PinDecl {
+	static constexpr std::array SETTING_LIST{PinSetting{Name, PinMode, PUPD, OType, OSpeed, AF}};
+};
+
+/**
+ * @brief		List of pin declaration, it is also a pin declaration, which is how drivers declare their pins, e.g.
+ * 					@ref Usart::PinDecls
+ * @tparam	Decls 	@ref PinDecl or @ref PinDeclList
+ */
+template <typename... Decls>
+struct PinDeclList {
+ private:
+	template <std::size_t... N>
+	static constexpr auto concat(std::array<PinSetting, N> const&... t_list) noexcept {
+		std::array<PinSetting, (0U + ... + N)> ret_val{};
+		std::size_t idx = 0;
+
+		constexpr auto copy_list = [](auto& t_dest, std::size_t& t_idx, auto const& t_src) {
+			for (auto const& setting : t_src) {
+				t_dest[t_idx++] = setting;
+			}
+		};
+
+		(copy_list(ret_val, idx, t_list), ...);
+		return ret_val;
+	}
+
+ public:
+	static constexpr auto SETTING_LIST = concat(Decls::SETTING_LIST...);
+};
+
+/**
+ * @brief		Declaration of output pins, same as what @ref DigitalOut sets up
+ */
+template <gpio::PinName... PinNames>
+using OutputPins = PinDeclList<PinDecl<PinNames, gpio::Mode::Output>...>;
+
+/**
+ * @brief		This class is used to report conflicting pin declarations, the pin is shown in the template argument
+ */
+template <gpio::PinName Name>
+struct PinConflict {
+	static constexpr bool value = (Name == gpio::PinName::NC);
+};
+
+/**
+ * @brief		This class is used to report pin of driver that isn't declared in @ref BoardPins, the pin is shown in the
+ * 					template argument
+ */
+template <gpio::PinName Name>
+struct PinUndeclared {
+	static constexpr bool value = (Name == gpio::PinName::NC);
+};
+
+/**
+ * @class 	BoardPinConfig
+ * @brief		This class merges all pin declarations of the program at compile time, and configures them by writing each
+ * 					GPIO configuration register exactly once, instead of read-modify-write of the same registers by every driver
+ * 					constructor. The same pin may be declared more than once, e.g. by two drivers, as long as the settings are
+ * 					the same, otherwise compilation fails with @ref PinConflict.
+ * @tparam	Decls 	@ref PinDecl, @ref PinDeclList, or pin declarations of drivers, e.g. @ref Usart::PinDecls
+ *
+ * @code{.cpp}
+ * 	using Board = BoardPinConfig<Usart<PinName::PA_2, PinName::PA_3>::PinDecls,
+ * 															 SPI<PinName::PA_6, PinName::PA_7, PinName::PA_5>::PinDecls,
+ * 															 OutputPins<PinName::PB_6>,	// chip select of SpiBus
+ * 															 PinDecl<PinName::PC_13, gpio::Mode::Input, gpio::Pupd::PullUp>>;
+ *
+ * 	int main() {
+ * 		Board const board_pins;
+ * 		...
+ * 	}
+ * @endcode
+ *
+ * @note 		Registers are written with settings merged into reset value, the pins that are not declared are kept as they
+ * 					are after reset, hence the object must be constructed at startup, before the ports are used by others. If
+ * 					BOARD_PIN_CONFIG is set (cmake option ENABLE_BOARD_PIN_CONFIG), driver constructors leave GPIO untouched,
+ * 					and every pin used by the program must be declared here, see @ref BoardPins.
+ */
+template <typename... Decls>
+class BoardPinConfig {
+ private:
+	static constexpr auto SETTING_LIST = PinDeclList<Decls...>::SETTING_LIST;
+	static constexpr auto PORT_NUM		 = to_underlying(gpio::Port::Total);
+
+	static constexpr auto findConflict() noexcept {
+		for (std::size_t i = 0; i < SETTING_LIST.size(); ++i) {
+			for (std::size_t j = i + 1; j < SETTING_LIST.size(); ++j) {
+				if (SETTING_LIST[i].name == SETTING_LIST[j].name && SETTING_LIST[i] != SETTING_LIST[j]) {
+					return SETTING_LIST[i].name;
+				}
+			}
+		}
+
+		return gpio::PinName::NC;
+	}
+
+	static_assert(PinConflict<findConflict()>::value, "Pin is declared with different settings");
+
+	static constexpr auto makeUsedPortList() noexcept {
+		std::array<bool, PORT_NUM> is_used{};
+		for (auto const& setting : SETTING_LIST) {
+			if (setting.name != gpio::PinName::NC) {
+				is_used[to_underlying(gpio::PinMap::getPort(setting.name))] = true;
+			}
+		}
+
+		std::array<gpio::Port, PORT_NUM> port_list{};
+		std::size_t port_num = 0;
+		for (std::size_t port = 0; port < PORT_NUM; ++port) {
+			if (is_used[port]) {
+				port_list[port_num++] = static_cast<gpio::Port>(port);
+			}
+		}
+
+		return std::pair{port_list, port_num};
+	}
+
+	static constexpr auto USED_PORT_LIST = makeUsedPortList().first; /*!< Only the first USED_PORT_NUM are valid */
+	static constexpr auto USED_PORT_NUM	 = makeUsedPortList().second;
+
+	template <gpio::Port GpioPort>
+	static constexpr auto makePortConfig() noexcept {
+		auto config = gpio::reset_port_config<GpioPort>();
+
+		for (auto const& setting : SETTING_LIST) {
+			if (setting.name != gpio::PinName::NC && gpio::PinMap::getPort(setting.name) == GpioPort) {
+				config.setPin(gpio::PinMap::getPin(setting.name), setting.mode, setting.pupd, setting.otype, setting.ospeed,
+											setting.af);
+			}
+		}
+
+		return config;
+	}
+
+	template <gpio::Port GpioPort>
+	static constexpr auto PORT_CONFIG = makePortConfig<GpioPort>();
+
+	template <std::size_t... Idx>
+	static constexpr void configure(std::index_sequence<Idx...> const /*unused*/) noexcept {
+		if constexpr (sizeof...(Idx) != 0) {
+			// all gpio clocks are in the same register, enabled by single write
+			rcc::enable_periph_clk<static_cast<rcc::PeriphClk>(USED_PORT_LIST[Idx])...>();
+		}
+
+		(gpio::write_port_config<USED_PORT_LIST[Idx]>(PORT_CONFIG<USED_PORT_LIST[Idx]>), ...);
+	}
+
+ public:
+	/**
+	 * @brief		Construct board pin configuration, it enables rcc peripheral clock of ports used, and configures all pins
+	 */
+	constexpr BoardPinConfig() noexcept { configure(std::make_index_sequence<USED_PORT_NUM>{}); }
+
+	/**
+	 * @brief		This function returns the configuration of a port written by constructor
+	 */
+	template <gpio::Port GpioPort>
+	[[nodiscard]] static constexpr auto portConfig() noexcept {
+		return PORT_CONFIG<GpioPort>;
+	}
+
+	/**
+	 * @brief		This function returns the first pin of t_list that isn't declared with the same setting, or NC if there is
+	 * 					none
+	 * @param 	t_check_speed 	false to ignore output speed, e.g. of driver that takes it as constructor argument
+	 */
+	template <std::size_t N>
+	[[nodiscard]] static constexpr gpio::PinName findUndeclared(std::array<PinSetting, N> const& t_list,
+																															bool const t_check_speed = true) noexcept {
+		for (auto const& setting : t_list) {
+			bool declared = (setting.name == gpio::PinName::NC);
+
+			for (auto const& decl : SETTING_LIST) {
+				auto expected = setting;
+				if (!t_check_speed) {
+					expected.ospeed = decl.ospeed;
+				}
+
+				declared = declared || decl == expected;
+			}
+
+			if (!declared) {
+				return setting.name;
+			}
+		}
+
+		return gpio::PinName::NC;
+	}
+};
+
+/**
+ * @brief		Pin configuration of the program if BOARD_PIN_CONFIG is set, which is defined by application as explicit
+ * 					specialization derived from @ref BoardPinConfig, before any driver is constructed. Driver constructors check
+ * 					their pins against it, see @ref check_board_pins.
+ *
+ * @code{.cpp}
+ * 	template <>
+ * 	struct cpp_stm32::driver::BoardPins<> : BoardPinConfig<Usart<PinName::PA_2, PinName::PA_3>::PinDecls,
+ * 																												 OutputPins<PinName::PB_6>> {};
+ *
+ * 	int main() {
+ * 		BoardPins<> const board_pins;
+ * 		...
+ * 	}
+ * @endcode
+ */
+template <typename = void>
+struct BoardPins;
+
+/**
+ * @brief		This function fails compilation with @ref PinUndeclared if BOARD_PIN_CONFIG is set, and pin of driver isn't
+ * 					declared in @ref BoardPins with the same setting, since driver constructor doesn't set it up then
+ * @tparam	Decls 			Pin declarations of driver, e.g. @ref Usart::PinDecls
+ * @tparam	CheckSpeed 	false to ignore output speed, see @ref BoardPinConfig::findUndeclared
+ */
+template <typename Decls, bool CheckSpeed = true>
+constexpr void check_board_pins() noexcept {
+	if constexpr (BOARD_PIN_CONFIG) {
+		// dependent on Decls, so that BoardPins is only required once a driver is constructed
+		constexpr auto undeclared = BoardPins<std::void_t<Decls>>::findUndeclared(Decls::SETTING_LIST, CheckSpeed);
+		static_assert(PinUndeclared<undeclared>::value, "Pin of driver isn't declared in BoardPins with the same setting");
+	}
+}
+
+}	// namespace cpp_stm32::driver
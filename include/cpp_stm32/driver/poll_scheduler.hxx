@@ -0,0 +1,333 @@
+/**
+ * @file  driver/poll_scheduler.hxx
+ * @brief	Periodic polling of devices sharing a bus
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "cpp_stm32/driver/i2c_async.hxx"
+#include "cpp_stm32/driver/spi_bus.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+namespace cpp_stm32::driver {
+
+/**
+ * @class 	SampleSink
+ * @brief		Writer side of @ref SampleBuffer, used by @ref PollScheduler
+ */
+class SampleSink {
+ private:
+	std::uint8_t* m_data;
+	std::size_t m_size;
+	std::atomic<std::uint32_t>* m_count;
+
+ public:
+	constexpr SampleSink(std::uint8_t* const t_data, std::size_t const t_size,
+											 std::atomic<std::uint32_t>* const t_count) noexcept
+		: m_data(t_data), m_size(t_size), m_count(t_count) {}
+
+	/**
+	 * @brief		This function returns the buffer that is not read, the next sample is written into it
+	 */
+	[[nodiscard]] Span<std::uint8_t> back() const noexcept {
+		return Span<std::uint8_t>{m_data + (m_count->load(std::memory_order_relaxed) & 1U) * m_size, m_size};
+	}
+
+	/**
+	 * @brief		This function makes the back buffer the latest sample
+	 */
+	void publish() const noexcept { m_count->fetch_add(1, std::memory_order_release); }
+};
+
+/**
+ * @class 	SampleBuffer
+ * @brief		Double buffer of samples of a device, the latest sample is read while the next one is being transferred
+ * @tparam	Size 	Size of sample in byte
+ */
+template <std::size_t Size>
+class SampleBuffer {
+ private:
+	std::array<std::uint8_t, 2 * Size> m_data{};
+	std::atomic<std::uint32_t> m_count{0}; /*!< Number of sample ever published */
+
+ public:
+	constexpr SampleBuffer() noexcept = default;
+
+	// the scheduler keeps the address of this object
+	SampleBuffer(SampleBuffer const&) = delete;
+	SampleBuffer& operator=(SampleBuffer const&) = delete;
+
+	[[nodiscard]] constexpr SampleSink sink() noexcept { return SampleSink{m_data.data(), Size, &m_count}; }
+
+	/**
+	 * @brief		This function copies the latest sample
+	 * @return	Number of sample ever published, 0 if there is none yet, in which case t_out is untouched
+	 */
+	std::uint32_t read(std::array<std::uint8_t, Size>& t_out) const noexcept {
+		while (true) {
+			auto const count = m_count.load(std::memory_order_acquire);
+			if (count == 0) {
+				return 0;
+			}
+
+			auto const front = m_data.begin() + static_cast<std::ptrdiff_t>(((count - 1) & 1U) * Size);
+			std::copy(front, front + static_cast<std::ptrdiff_t>(Size), t_out.begin());
+
+			// the buffer is written again only after the next sample is published, the fence keeps the copy before the
+			// count is checked again, which acquire load alone doesn't
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (m_count.load(std::memory_order_relaxed) == count) {
+				return count;
+			}
+		}
+	}
+
+	[[nodiscard]] std::uint32_t count() const noexcept { return m_count.load(std::memory_order_acquire); }
+};
+
+/**
+ * @brief		Register burst read of I2C device, see @ref I2cAsync::readRegisters
+ */
+struct I2cPoll {
+	i2c::SlaveAddr7_t slave;
+	std::uint8_t reg; /*!< Address of the first register, including auto increment flag if the device requires one */
+};
+
+/**
+ * @brief		Full duplex transfer of 8 bit SPI device, see @ref SpiBus::transfer
+ */
+template <spi::Port SPI>
+struct SpiPoll {
+	SpiDevice<SPI> const* device;
+	Span<std::uint8_t const> command; /*!< Transmitted first, 0 is sent after it runs out */
+};
+
+/**
+ * @brief		Entry of polling table
+ */
+template <typename Xact>
+struct PollEntry {
+	Xact xact;
+	std::uint32_t period; /*!< In unit of the time passed to @ref PollScheduler::poll, must not be 0 */
+	SampleSink sink;			/*!< Its size is the number of byte read */
+};
+
+/**
+ * @class 	PollScheduler
+ * @brief		Runs transactions of a static table periodically on one bus. @ref poll queues the due transactions, which are
+ * 					started earliest deadline first as soon as the bus is free, so that they are packed back to back, and the
+ * 					start of each transaction is delayed by at most the transactions before it. Deadlines are advanced by
+ * 					period, so that the delay doesn't accumulate.
+ * @tparam	Bus 	@ref I2cAsync, the next queued transaction is started by completion callback of the previous one, in I2C
+ * 								interrupt, or @ref SpiBus, queued transactions are run by @ref poll directly
+ * @tparam	Xact 	@ref I2cPoll or @ref SpiPoll
+ * @tparam	N 		Number of entry, at most 32
+ *
+ * @code{.cpp}
+ * 	SampleBuffer<6> gyro;
+ * 	SampleBuffer<6> accel;
+ *
+ * 	std::array const table{
+ * 		PollEntry<I2cPoll>{I2cPoll{i2c::SlaveAddr7_t{GYRO_ADDR}, OUT_X_L_G | AUTO_INCREMENT}, 2, gyro.sink()},		// 500 Hz
+ * 		PollEntry<I2cPoll>{I2cPoll{i2c::SlaveAddr7_t{ACCEL_ADDR}, OUT_X_L_A | AUTO_INCREMENT}, 10, accel.sink()},	// 100 Hz
+ * 	};
+ *
+ * 	PollScheduler scheduler{imu, table};
+ *
+ * 	while (true) {
+ * 		scheduler.poll(millis());
+ * 		if (std::array<std::uint8_t, 6> sample{}; gyro.read(sample) != last_count) { ... }
+ * 	}
+ * @endcode
+ *
+ * @note 		@ref poll must be called from one context only, and the bus must not be used by others. Completion callback
+ * 					carries no context, the scheduler of I2C bus is therefore found by static pointer, i.e. one scheduler per bus.
+ */
+template <typename Bus, typename Xact, std::size_t N>
+class PollScheduler {
+ private:
+	static constexpr bool IS_I2C = std::is_same_v<Xact, I2cPoll>;
+
+	static_assert(N <= 32, "Pending entries are kept in 32 bit mask");
+
+	static inline PollScheduler* s_self{nullptr}; /*!< Scheduler of the bus, see @ref onComplete */
+
+	Bus& m_bus;
+	std::array<PollEntry<Xact>, N> const& m_table;
+	std::array<std::uint32_t, N> m_due{};
+	std::array<std::uint32_t, N> m_deadline{}; /*!< Due time of pending entry, written by poll before it is pending */
+	std::atomic<std::uint32_t> m_pending{0};	 /*!< Bit i is set if entry i is queued but not started */
+	std::atomic<std::size_t> m_running{N};		 /*!< Index of the transaction on the bus, N if there is none */
+	std::uint32_t m_overrun{0};
+	std::atomic<std::uint32_t> m_failure{0};
+
+	[[nodiscard]] static constexpr bool isDue(std::uint32_t const t_now, std::uint32_t const t_due) noexcept {
+		return static_cast<std::int32_t>(t_now - t_due) >= 0;
+	}
+
+	/**
+	 * @brief		This function queues due entries, and advances their deadlines. Entry that is still pending, or periods
+	 * 					that are missed entirely, are skipped rather than run back to back
+	 */
+	void queueDue(std::uint32_t const t_now) noexcept {
+		for (std::size_t i = 0; i < N; ++i) {
+			if (!isDue(t_now, m_due[i])) {
+				continue;
+			}
+
+			auto const due		= m_due[i];
+			auto const period = std::max(m_table[i].period, std::uint32_t{1});
+			for (m_due[i] += period; isDue(t_now, m_due[i]); m_due[i] += period) {
+				++m_overrun;
+			}
+
+			auto const bit = std::uint32_t{1} << i;
+			if ((m_pending.load(std::memory_order_relaxed) & bit) != 0U) {
+				++m_overrun;
+				continue;
+			}
+
+			m_deadline[i] = due;
+			m_pending.fetch_or(bit, std::memory_order_release);
+		}
+	}
+
+	/**
+	 * @brief		This function removes the pending entry of the earliest deadline from queue
+	 * @return	Index of the entry, or N if none is pending
+	 */
+	std::size_t takeNext() noexcept {
+		auto const pending = m_pending.load(std::memory_order_acquire);
+		std::size_t next	 = N;
+
+		for (std::size_t i = 0; i < N; ++i) {
+			if ((pending & (std::uint32_t{1} << i)) != 0U &&
+					(next == N || static_cast<std::int32_t>(m_deadline[i] - m_deadline[next]) < 0)) {
+				next = i;
+			}
+		}
+
+		if (next != N) {
+			m_pending.fetch_and(~(std::uint32_t{1} << next), std::memory_order_relaxed);
+		}
+
+		return next;
+	}
+
+	bool start(PollEntry<Xact> const& t_entry) noexcept {
+		auto const dest = t_entry.sink.back();
+
+		if constexpr (IS_I2C) {
+			return m_bus.readRegisters(t_entry.xact.slave, t_entry.xact.reg, dest, &PollScheduler::onComplete);
+		} else {
+			return m_bus.transfer(*t_entry.xact.device, t_entry.xact.command, dest);
+		}
+	}
+
+	/**
+	 * @brief		This function starts pending transactions, the bus must be free. SPI transfer is completed on return, I2C
+	 * 					one is completed in interrupt, which calls this function again
+	 */
+	void run() noexcept {
+		for (auto idx = takeNext(); idx != N; idx = takeNext()) {
+			m_running.store(idx, std::memory_order_relaxed);
+
+			if (!start(m_table[idx])) {
+				m_failure.fetch_add(1, std::memory_order_relaxed);
+				continue;
+			}
+
+			if constexpr (IS_I2C) {
+				return;
+			}
+
+			m_table[idx].sink.publish();
+		}
+
+		m_running.store(N, std::memory_order_release);
+	}
+
+	/**
+	 * @brief		Completion callback of I2C transaction, called in I2C interrupt
+	 */
+	static void onComplete() noexcept {
+		auto& self = *s_self;
+
+		if (self.m_bus.failed()) {
+			self.m_failure.fetch_add(1, std::memory_order_relaxed);
+		} else {
+			self.m_table[self.m_running.load(std::memory_order_relaxed)].sink.publish();
+		}
+
+		self.run();
+	}
+
+ public:
+	/**
+	 * @brief		Construct scheduler, every entry is due at t_now
+	 */
+	PollScheduler(Bus& t_bus, std::array<PollEntry<Xact>, N> const& t_table, std::uint32_t const t_now = 0) noexcept
+		: m_bus(t_bus), m_table(t_table) {
+		m_due.fill(t_now);
+
+		if constexpr (IS_I2C) {
+			s_self = this;
+		}
+	}
+
+	PollScheduler(PollScheduler const&) = delete;
+	PollScheduler& operator=(PollScheduler const&) = delete;
+
+	/**
+	 * @brief		This function queues the due transactions, and starts them if the bus is free, call it often, e.g. in main
+	 * 					loop
+	 * @param 	t_now 	Current time, wrap around is allowed
+	 *
+	 * @note 		I2C transaction queued while the last one is completing is started by the next call
+	 */
+	void poll(std::uint32_t const t_now) noexcept {
+		queueDue(t_now);
+
+		// no completion callback is pending if the bus is free
+		if (m_running.load(std::memory_order_acquire) == N) {
+			run();
+		}
+	}
+
+	/**
+	 * @brief		This function returns number of period skipped because the bus was too busy
+	 */
+	[[nodiscard]] std::uint32_t overrunCount() const noexcept { return m_overrun; }
+
+	/**
+	 * @brief		This function returns number of transaction that failed or couldn't be started, their samples are not
+	 * 					published
+	 */
+	[[nodiscard]] std::uint32_t failureCount() const noexcept { return m_failure.load(std::memory_order_relaxed); }
+};
+
+}	// namespace cpp_stm32::driver
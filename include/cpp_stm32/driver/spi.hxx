@@ -23,9 +23,12 @@
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
 
 #include "cpp_stm32/driver/gpio_base.hxx"
+#include "cpp_stm32/driver/pin_config.hxx"
 #include "cpp_stm32/utility/serial.hxx"
+#include "cpp_stm32/utility/span.hxx"
 
 #include "pin_map/spi.hxx"
 
@@ -64,6 +67,13 @@ class SPI {
 	static constexpr auto RCC = std::get<3>(MISO_PIN);
 
  public:
+	/**
+	 * @brief		Pins set up by constructor, see @ref BoardPinConfig
+	 */
+	using PinDecls = PinDeclList<PinDecl<MISO, gpio::Mode::AltFunc, gpio::Pupd::None, MISO_AF>,
+															 PinDecl<MOSI, gpio::Mode::AltFunc, gpio::Pupd::None, MOSI_AF>,
+															 PinDecl<SCLK, gpio::Mode::AltFunc, gpio::Pupd::None, SCLK_AF>>;
+
 	/**
 	 * @brief    Construct SPI with
 	 */
@@ -71,6 +81,7 @@ class SPI {
 						typename = std::enable_if_t<NSS == gpio::PinName::NC>>
 	explicit constexpr SPI(Miso<MISO> const /**/, Mosi<MOSI> const /**/, Sclk<SCLK> const /**/, spi::Mode const t_mode,
 												 size_c<Ds> t_ds, Frequency<HZ> const t_freq) noexcept {
+		check_board_pins<PinDecls>();
 		GpioUtil<MISO, MOSI, SCLK>::enableAllGpioClk();
 		GpioUtil<MISO, MOSI, SCLK>::modeSetup(gpio::Mode::AltFunc, gpio::Pupd::None);
 
@@ -99,9 +110,13 @@ class SPI {
 	 * @brief    This function sets CPOL and CPHA
 	 * @param    t_mode @ref spi::Mode
 	 *
-	 * @bug  This doesn't work
+	 * @note     SPI is disabled only after the last frame is shifted out, as required by reference manual, see
+	 *           @ref SpiBus for devices of different mode on the same bus
 	 */
 	void setMode(spi::Mode const t_mode) const noexcept {
+		spi::wait_status<PORT, spi::Status::TXE>(true);
+		spi::wait_status<PORT, spi::Status::BSY>(false);
+
 		spi::disable<PORT>();
 		spi::set_mode<PORT>(t_mode);
 		spi::enable<PORT>();
@@ -111,9 +126,13 @@ class SPI {
 
 	constexpr void setLsbFirst() const noexcept { spi::set_lsb_first<PORT>(); }
 
+	/**
+	 * @brief    This function sets the closest prescaler, see @ref spi::calc_baudrate_prescaler
+	 */
 	template <std::uint32_t HZ>
-	constexpr void setBaudrate(Frequency<HZ> const) const noexcept {
-		// @todo implement
+	constexpr void setBaudrate(Frequency<HZ> const t_freq) const noexcept {
+		spi::wait_status<PORT, spi::Status::BSY>(false);
+		spi::set_baudrate<PORT>(t_freq);
 	}
 
 	template <typename DataType, std::uint8_t BC>
@@ -127,6 +146,16 @@ class SPI {
 		return spi::xfer_blocking<PORT>(t_bc, t_val.begin(), t_val.end());
 	}
 
+	/**
+	 * @brief		This function transmits and receives at the same time, see @ref spi::xfer_full_duplex
+	 * @param 	t_tx 	Data to transmit, 0 is sent after it runs out
+	 * @param 	t_rx 	Buffer of received data, DataType must match data size given in constructor
+	 */
+	template <typename DataType>
+	void xfer(Span<std::common_type_t<DataType> const> const t_tx, Span<DataType> const t_rx) const noexcept {
+		spi::xfer_full_duplex<PORT>(t_tx, t_rx);
+	}
+
 	template <std::size_t N>
 	constexpr void send(std::array<std::uint8_t, N> const& t_val) const noexcept {
 		spi::send_blocking<PORT>(t_val.begin(), t_val.end());
@@ -0,0 +1,298 @@
+/**
+ * @file  driver/spi_bus.hxx
+ * @brief	SPI bus shared by multiple devices
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "cpp_stm32/driver/gpio_base.hxx"
+#include "cpp_stm32/driver/pin_config.hxx"
+#include "cpp_stm32/driver/spi.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+#include "spi.hxx"
+
+namespace cpp_stm32::driver {
+
+using SpiBusCallback = void (*)() noexcept;
+
+template <spi::Port SPI, std::size_t Depth>
+class SpiBus;
+
+/**
+ * @class 	SpiDevice
+ * @brief		Configuration of a device on @ref SpiBus: clock mode, prescaler, frame size, bit order and chip select pin
+ * @tparam	SPI 	@ref spi::Port the device is connected to
+ *
+ * @note 		The device is referred to by address while it is used by the bus, declare it with static storage duration.
+ */
+template <spi::Port SPI>
+class SpiDevice {
+ private:
+	template <spi::Port, std::size_t>
+	friend class SpiBus;
+
+	using ChipSelect = void (*)(bool) noexcept;
+
+	template <gpio::PinName CS>
+	static void selectChip(bool const t_select) noexcept {
+		t_select ? GpioUtil<CS>::clear() : GpioUtil<CS>::set();
+	}
+
+	spi::Mode const m_mode;
+	spi::Baudrate_t const m_prescaler;
+	spi::DataFrameFormat const m_dff;
+	bool const m_lsbFirst;
+	ChipSelect const m_select;
+
+	[[nodiscard]] constexpr bool sameConfig(SpiDevice const& t_other) const noexcept {
+		return m_mode == t_other.m_mode && m_prescaler.get() == t_other.m_prescaler.get() && m_dff == t_other.m_dff &&
+					 m_lsbFirst == t_other.m_lsbFirst;
+	}
+
+ public:
+	/**
+	 * @brief		Pins set up by constructor, i.e. chip select, see @ref BoardPinConfig
+	 */
+	template <gpio::PinName CS>
+	using PinDecls = OutputPins<CS>;
+
+	/**
+	 * @brief		Construct device, and set up chip select pin as output, deasserted (high)
+	 * @param 	t_mode 			@ref spi::Mode
+	 * @param 	t_ds 				Frame size, 8 or 16
+	 * @param 	t_freq 			Desired SCLK frequency, see @ref spi::calc_baudrate_prescaler
+	 * @param 	t_lsbFirst 	Bit order
+	 */
+	template <gpio::PinName CS, std::size_t Ds, std::uint32_t HZ>
+	constexpr SpiDevice(Nss<CS> const /**/, spi::Mode const t_mode, size_c<Ds> const /**/, Frequency<HZ> const t_freq,
+											bool const t_lsbFirst = false) noexcept
+		: m_mode(t_mode),
+			m_prescaler(spi::calc_baudrate_prescaler<SPI>(t_freq)),
+			m_dff(spi::DataFrameFormat{Ds > sizeof(std::uint8_t) * 8}),
+			m_lsbFirst(t_lsbFirst),
+			m_select(&selectChip<CS>) {
+		static_assert(Ds == 8 || Ds == 16);
+
+		check_board_pins<PinDecls<CS>>();
+		GpioUtil<CS>::enableAllGpioClk();
+		GpioUtil<CS>::modeSetup(gpio::Mode::Output, gpio::Pupd::None);
+		GpioUtil<CS>::set();
+	}
+
+	SpiDevice(SpiDevice const&) = delete;
+	SpiDevice& operator=(SpiDevice const&) = delete;
+
+	[[nodiscard]] constexpr bool isHalfWord() const noexcept { return m_dff == spi::DataFrameFormat::Halfword; }
+};
+
+/**
+ * @class 	SpiBus
+ * @brief		Runs transfers of multiple devices on one SPI. CR1 is written only when the configuration of the device
+ * 					differs from the one of the previous transfer, and SPI is disabled only if clock mode, bit order or frame
+ * 					size changes, so consecutive transfers to devices with the same configuration cost no register write at
+ * 					all, and devices that differ in SCLK frequency only cost one. Transfers can be queued by one context, e.g.
+ * 					a timer interrupt, and are run in order by @ref process.
+ * @tparam	SPI 		@ref spi::Port
+ * @tparam	Depth 	Max number of queued transfer
+ *
+ * @code{.cpp}
+ * 	// pins, clock and master mode are set up by SPI, the configuration is overridden per transfer
+ * 	Driver::SPI const spi{Miso<PinName::PB_14>{}, Mosi<PinName::PB_15>{}, Sclk<PinName::PB_13>{}, ...};
+ *
+ * 	SpiDevice<spi::Port::SPI2> const gyro{Nss<PinName::PB_12>{}, spi::Mode::Mode3, size_c<8>{}, 10_MHz};
+ * 	SpiDevice<spi::Port::SPI2> const adc{Nss<PinName::PB_1>{}, spi::Mode::Mode1, size_c<16>{}, 20_MHz};
+ * 	SpiBus<spi::Port::SPI2> bus;
+ *
+ * 	bus.submit(gyro, Span{gyro_cmd}, Span{gyro_data});		// e.g. in timer interrupt
+ * 	bus.submit(adc, Span<std::uint16_t const>{}, Span{samples}, &on_samples);
+ * 	bus.process();																				// in main loop
+ * @endcode
+ *
+ * @note 		The bus assumes CR1 is modified only by itself once it is in use, call @ref invalidate otherwise.
+ */
+template <spi::Port SPI, std::size_t Depth = 8>
+class SpiBus {
+ private:
+	static_assert(0 < Depth);
+
+	struct Transfer {
+		SpiDevice<SPI> const* device{nullptr};
+		void const* tx{nullptr};
+		void* rx{nullptr};
+		std::size_t txSize{0};
+		std::size_t rxSize{0};
+		SpiBusCallback onComplete{nullptr};
+	};
+
+	std::array<Transfer, Depth> m_queue{};
+	std::atomic<std::uint32_t> m_queued{0}; /*!< Number of transfer ever queued, written by submitter only */
+	std::atomic<std::uint32_t> m_done{0};		/*!< Number of transfer ever done, written by process only */
+	SpiDevice<SPI> const* m_current{nullptr};
+
+	/**
+	 * @brief		This function applies the configuration of the device, the bus must be idle
+	 */
+	void configure(SpiDevice<SPI> const& t_dev) noexcept {
+		if (m_current != nullptr && m_current->sameConfig(t_dev)) {
+			m_current = &t_dev;
+			return;
+		}
+
+		using spi::reg::CR1Field, spi::reg::CR1, spi::Mode;
+
+		std::uint8_t const idle_high					 = (t_dev.m_mode == Mode::Mode2 || t_dev.m_mode == Mode::Mode3);
+		std::uint8_t const second_edge_capture = (t_dev.m_mode == Mode::Mode1 || t_dev.m_mode == Mode::Mode3);
+		std::uint8_t const lsb_first					 = t_dev.m_lsbFirst;
+
+		// CPOL, CPHA, LSBFIRST and DFF must only be written while SPI is disabled (RM0390), BR can be changed while the
+		// bus is idle
+		if (m_current == nullptr || m_current->m_mode != t_dev.m_mode || m_current->m_lsbFirst != t_dev.m_lsbFirst ||
+				m_current->m_dff != t_dev.m_dff) {
+			// the peripheral may be left transmitting by whoever used it before the bus, SPE must not be cleared in the
+			// middle of a frame, transfers of the bus itself end with BSY polled in run()
+			if (m_current == nullptr) {
+				spi::wait_status<SPI, spi::Status::TXE>(true);
+				spi::wait_status<SPI, spi::Status::BSY>(false);
+			}
+
+			CR1<SPI>.template writeBit<CR1Field::SPE, CR1Field::CPHA, CR1Field::CPOL, CR1Field::BR, CR1Field::LSBFIRST,
+																 CR1Field::DFF>(std::uint8_t{0}, second_edge_capture, idle_high, t_dev.m_prescaler,
+																								lsb_first, t_dev.m_dff);
+			spi::enable<SPI>();
+		} else {
+			CR1<SPI>.template writeBit<CR1Field::BR>(t_dev.m_prescaler);
+		}
+
+		m_current = &t_dev;
+	}
+
+	void run(Transfer const& t_xfer) noexcept {
+		auto const& dev = *t_xfer.device;
+
+		configure(dev);
+		dev.m_select(true);
+
+		if (dev.isHalfWord()) {
+			spi::xfer_full_duplex<SPI>(Span{static_cast<std::uint16_t const*>(t_xfer.tx), t_xfer.txSize},
+																 Span{static_cast<std::uint16_t*>(t_xfer.rx), t_xfer.rxSize});
+		} else {
+			spi::xfer_full_duplex<SPI>(Span{static_cast<std::uint8_t const*>(t_xfer.tx), t_xfer.txSize},
+																 Span{static_cast<std::uint8_t*>(t_xfer.rx), t_xfer.rxSize});
+		}
+
+		// the last frame is received, SCLK may still be running for the rest of the bit
+		spi::wait_status<SPI, spi::Status::BSY>(false);
+		dev.m_select(false);
+	}
+
+	template <typename DataType>
+	[[nodiscard]] static constexpr bool isFrameOf(SpiDevice<SPI> const& t_dev) noexcept {
+		static_assert(std::is_same_v<DataType, std::uint8_t> || std::is_same_v<DataType, std::uint16_t>);
+		return t_dev.isHalfWord() == std::is_same_v<DataType, std::uint16_t>;
+	}
+
+ public:
+	constexpr SpiBus() noexcept = default;
+
+	SpiBus(SpiBus const&) = delete;
+	SpiBus& operator=(SpiBus const&) = delete;
+
+	/**
+	 * @brief		This function queues transfer, it is run by @ref process
+	 * @param 	t_dev 	Device to transfer with
+	 * @param 	t_tx 		Data to transmit, 0 is sent after it runs out, must stay unmodified until the transfer is done
+	 * @param 	t_rx 		Buffer of received data, frames that don't fit are dropped
+	 * @param 	t_cb 		Called by @ref process after the transfer is done
+	 * @return	false if queue is full, or DataType doesn't match frame size of the device, nothing is queued
+	 */
+	template <typename DataType>
+	bool submit(SpiDevice<SPI> const& t_dev, Span<std::common_type_t<DataType> const> const t_tx,
+							Span<DataType> const t_rx, SpiBusCallback const t_cb = nullptr) noexcept {
+		auto const queued = m_queued.load(std::memory_order_relaxed);
+		if (!isFrameOf<DataType>(t_dev) || queued - m_done.load(std::memory_order_acquire) == Depth) {
+			return false;
+		}
+
+		m_queue[queued % Depth] = Transfer{&t_dev, t_tx.data(), t_rx.data(), t_tx.size(), t_rx.size(), t_cb};
+		m_queued.store(queued + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/**
+	 * @brief		This function runs queued transfers in order, and returns when the queue is empty
+	 * @return	Number of transfer run
+	 */
+	std::size_t process() noexcept {
+		std::size_t count = 0;
+
+		for (auto done = m_done.load(std::memory_order_relaxed); done != m_queued.load(std::memory_order_acquire);
+				 ++done, ++count) {
+			auto const xfer = m_queue[done % Depth];
+			run(xfer);
+
+			// the slot is released before the callback, so that the callback can queue next transfer
+			m_done.store(done + 1, std::memory_order_release);
+
+			if (xfer.onComplete != nullptr) {
+				xfer.onComplete();
+			}
+		}
+
+		return count;
+	}
+
+	/**
+	 * @brief		This function transfers immediately, bypassing the queue, it must be called from the context that calls
+	 * 					@ref process
+	 * @return	false if DataType doesn't match frame size of the device
+	 */
+	template <typename DataType>
+	bool transfer(SpiDevice<SPI> const& t_dev, Span<std::common_type_t<DataType> const> const t_tx,
+								Span<DataType> const t_rx) noexcept {
+		if (!isFrameOf<DataType>(t_dev)) {
+			return false;
+		}
+
+		run(Transfer{&t_dev, t_tx.data(), t_rx.data(), t_tx.size(), t_rx.size(), nullptr});
+		return true;
+	}
+
+	/**
+	 * @brief		This function returns number of transfer in queue
+	 */
+	[[nodiscard]] std::size_t pending() const noexcept {
+		return m_queued.load(std::memory_order_relaxed) - m_done.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief		This function forces CR1 to be written by next transfer, call it if CR1 is modified elsewhere
+	 */
+	void invalidate() noexcept { m_current = nullptr; }
+};
+
+}	// namespace cpp_stm32::driver
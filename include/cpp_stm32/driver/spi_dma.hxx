@@ -0,0 +1,247 @@
+/**
+ * @file  driver/spi_dma.hxx
+ * @brief	Full duplex SPI transfer by DMA
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "cpp_stm32/driver/gpio_base.hxx"
+#include "cpp_stm32/driver/pin_config.hxx"
+#include "cpp_stm32/hal/callback.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+#include "dma.hxx"
+#include "nvic.hxx"
+#include "pin_map/dma.hxx"
+#include "spi.hxx"
+
+namespace cpp_stm32::driver {
+
+using SpiDmaCallback = void (*)() noexcept;
+
+/**
+ * @class 	SpiDma
+ * @brief		Full duplex transfer by a pair of DMA streams, RX stream writes received frames, TX stream feeds transmitted
+ * 					ones. The transfer completes from RX transfer complete interrupt, i.e. after the last frame is received, so
+ * 					chip select is released only when the bus is idle.
+ * @tparam	SPI 		@ref spi::Port
+ * @tparam	DMA 		@ref dma::Port, both streams belong to the same DMA
+ * @tparam	RxStr 	@ref dma::Stream of SPI RX request
+ * @tparam	TxStr 	@ref dma::Stream of SPI TX request
+ * @tparam	CS 			Chip select pin, driven low during transfer, or NC if it is handled elsewhere
+ *
+ * @code{.cpp}
+ * 	using Streams = dma::StreamAllocator<dma::Use<dma::Request::Spi2Rx>, dma::Use<dma::Request::Spi2Tx>>;
+ * 	constexpr auto RX_DMA = Streams::get<dma::Request::Spi2Rx>();
+ * 	constexpr auto TX_DMA = Streams::get<dma::Request::Spi2Tx>();
+ *
+ * 	SpiDma<spi::Port::SPI2, RX_DMA.port, RX_DMA.stream, TX_DMA.stream, gpio::PinName::PB_12> flash;
+ * 	flash.start(RX_DMA.channel, TX_DMA.channel);
+ * 	flash.xferAsync(Span{read_cmd}, Span{page}, &on_page_read);		// returns immediately
+ * @endcode
+ *
+ * @note 		Buffers must stay untouched until the transfer completes. SPI must be configured, e.g. by @ref SPI, with
+ * 					data frame format matching the type of data, and the DMA clock must be enabled.
+ */
+template <spi::Port SPI, dma::Port DMA, dma::Stream RxStr, dma::Stream TxStr, gpio::PinName CS = gpio::PinName::NC>
+class SpiDma {
+ private:
+	static_assert(RxStr != TxStr);
+
+	static constexpr auto RX_IRQ_NUM = dma::IrqMap::template getIrqNum<DMA, RxStr>();
+	static constexpr auto TX_IRQ_NUM = dma::IrqMap::template getIrqNum<DMA, TxStr>();
+	static constexpr auto DR_ADDR		 = spi::reg::DR<SPI>.memoryAddr();
+	static constexpr auto MAX_LENGTH = std::size_t{0xFFFFU};	// NDTR is 16 bit
+
+	template <typename DataType>
+	static constexpr auto DATA_SIZE = sizeof(DataType) == 1 ? dma::DataSize::Byte : dma::DataSize::HalfWord;
+
+	std::uint16_t m_txDummy{0}; /*!< Transmitted when there is no tx data, address doesn't increment */
+	std::uint16_t m_rxDummy{0}; /*!< Sink of received frames when there is no rx buffer */
+	SpiDmaCallback m_onComplete{nullptr};
+	std::atomic<bool> m_busy{false};
+	std::atomic<bool> m_error{false};
+
+	dma::Channel m_rxChannel{dma::Channel::Channel0};
+	dma::Channel m_txChannel{dma::Channel::Channel0};
+	dma::StreamPriority m_prior{dma::StreamPriority::High};
+
+	static constexpr void selectChip(bool const t_select) noexcept {
+		if constexpr (CS != gpio::PinName::NC) {
+			t_select ? GpioUtil<CS>::clear() : GpioUtil<CS>::set();
+		}
+	}
+
+	void irqHandler() noexcept {
+		using dma::InterruptFlag;
+
+		auto const [rx_tc, rx_te] = dma::get_interrupt_flag<DMA, RxStr, InterruptFlag::TCI, InterruptFlag::TEI>();
+		auto const [tx_te]				= dma::get_interrupt_flag<DMA, TxStr, InterruptFlag::TEI>();
+		if (rx_tc == 0 && rx_te == 0 && tx_te == 0) {
+			return;
+		}
+
+		dma::clear_interrupt_flag<DMA, RxStr, InterruptFlag::TCI, InterruptFlag::TEI>();
+		dma::clear_interrupt_flag<DMA, TxStr, InterruptFlag::TCI, InterruptFlag::TEI>();
+
+		bool const error = rx_te != 0 || tx_te != 0;
+		if (error) {
+			dma::disable<DMA, RxStr>();
+			dma::disable<DMA, TxStr>();
+		}
+
+		spi::disable_tx_dma<SPI>();
+		spi::disable_rx_dma<SPI>();
+		selectChip(false);
+
+		m_error.store(error, std::memory_order_relaxed);
+		m_busy.store(false, std::memory_order_release);
+
+		if (m_onComplete != nullptr) {
+			m_onComplete();
+		}
+	}
+
+ public:
+	/**
+	 * @brief		Pins set up by @ref start, i.e. chip select, none if it is NC, see @ref BoardPinConfig
+	 */
+	using PinDecls = OutputPins<CS>;
+
+	constexpr SpiDma() noexcept = default;
+
+	// DMA interrupt keeps the address of this object
+	SpiDma(SpiDma const&) = delete;
+	SpiDma& operator=(SpiDma const&) = delete;
+
+	/**
+	 * @brief		This function attaches DMA interrupts, and sets up chip select pin
+	 * @param 	t_rxCh 		DMA request channel of SPI RX
+	 * @param 	t_txCh 		DMA request channel of SPI TX
+	 * @param 	t_prior 	Priority of both streams
+	 */
+	void start(dma::Channel const t_rxCh, dma::Channel const t_txCh,
+						 dma::StreamPriority const t_prior = dma::StreamPriority::High) noexcept {
+		m_rxChannel = t_rxCh;
+		m_txChannel = t_txCh;
+		m_prior			= t_prior;
+
+		if constexpr (CS != gpio::PinName::NC) {
+			check_board_pins<PinDecls>();
+			GpioUtil<CS>::enableAllGpioClk();
+			GpioUtil<CS>::modeSetup(gpio::Mode::Output, gpio::Pupd::None);
+			selectChip(false);
+		}
+
+		nvic::enable_irq<RX_IRQ_NUM>(Callback<&SpiDma::irqHandler>{this});
+		nvic::enable_irq<TX_IRQ_NUM>(Callback<&SpiDma::irqHandler>{this});
+	}
+
+	/**
+	 * @brief		This function starts the transfer, and returns without waiting
+	 * @param 	t_tx 	Data to transmit, or empty to transmit 0
+	 * @param 	t_rx 	Buffer of received data, or empty to drop them
+	 * @param 	t_cb 	Called in DMA interrupt when the transfer completes, or nullptr to poll @ref done instead
+	 * @return	false if a transfer is ongoing, both are empty, sizes differ, or size exceeds 65535, nothing is started
+	 */
+	template <typename DataType>
+	bool xferAsync(Span<std::common_type_t<DataType> const> const t_tx, Span<DataType> const t_rx,
+								 SpiDmaCallback const t_cb = nullptr) noexcept {
+		static_assert(std::is_same_v<DataType, std::uint8_t> || std::is_same_v<DataType, std::uint16_t>);
+
+		auto const count = std::max(t_tx.size(), t_rx.size());
+		if (count == 0 || count > MAX_LENGTH || (!t_tx.empty() && !t_rx.empty() && t_tx.size() != t_rx.size())) {
+			return false;
+		}
+
+		if (m_busy.exchange(true, std::memory_order_acquire)) {
+			return false;
+		}
+
+		m_onComplete = t_cb;
+		m_error.store(false, std::memory_order_relaxed);
+
+		// stale frame would otherwise be the first one received
+		if (std::get<0>(spi::get_status<SPI, spi::Status::RXNE>())) {
+			std::ignore = spi::reg::DR<SPI>.template readBit<spi::reg::DRField::DR>(ValueOnly);
+		}
+
+		using dma::InterruptFlag, dma::MemoryAddress_t, dma::PeriphAddress_t;
+		constexpr auto WIDTH = DATA_SIZE<DataType>;
+		auto const num			 = static_cast<std::uint16_t>(count);
+
+		auto const rx_addr = t_rx.empty() ? reinterpret_cast<std::uintptr_t>(&m_rxDummy)
+																			: reinterpret_cast<std::uintptr_t>(t_rx.data());
+		auto rx_stream = dma::DmaBuilder<DMA, RxStr>{}
+												 .transferDir(PeriphAddress_t{DR_ADDR}, MemoryAddress_t{rx_addr})
+												 .txDataNum(num)
+												 .selectChannel(m_rxChannel)
+												 .streamPriority(m_prior)
+												 .perihperalDataWidth(WIDTH)
+												 .memoryDataWidth(WIDTH)
+												 .template enableInterrupt<InterruptFlag::TCI, InterruptFlag::TEI>();
+
+		auto const tx_addr = t_tx.empty() ? reinterpret_cast<std::uintptr_t>(&m_txDummy)
+																			: reinterpret_cast<std::uintptr_t>(t_tx.data());
+		auto tx_stream = dma::DmaBuilder<DMA, TxStr>{}
+												 .transferDir(MemoryAddress_t{tx_addr}, PeriphAddress_t{DR_ADDR})
+												 .txDataNum(num)
+												 .selectChannel(m_txChannel)
+												 .streamPriority(m_prior)
+												 .perihperalDataWidth(WIDTH)
+												 .memoryDataWidth(WIDTH)
+												 .template enableInterrupt<InterruptFlag::TEI>();
+
+		(t_rx.empty() ? rx_stream : rx_stream.enableMemIncrement()).build();
+		(t_tx.empty() ? tx_stream : tx_stream.enableMemIncrement()).build();
+
+		selectChip(true);
+
+		// RX request is enabled first, as required by reference manual, TX request starts the transfer since TXE is set
+		spi::enable_rx_dma<SPI>();
+		spi::enable_tx_dma<SPI>();
+
+		return true;
+	}
+
+	/**
+	 * @brief		This function checks whether the last transfer is completed
+	 */
+	[[nodiscard]] bool done() const noexcept { return !m_busy.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief		This function checks whether the last transfer is stopped by DMA transfer error, the data is invalid if so
+	 */
+	[[nodiscard]] bool failed() const noexcept { return m_error.load(std::memory_order_relaxed); }
+
+	void wait() const noexcept {
+		while (!done()) {
+		}
+	}
+};
+
+}	// namespace cpp_stm32::driver
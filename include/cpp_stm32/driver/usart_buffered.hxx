@@ -0,0 +1,188 @@
+/**
+ * @file  driver/usart_buffered.hxx
+ * @brief	Interrupt driven, non-blocking usart
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "cpp_stm32/driver/usart_serial.hxx"
+#include "cpp_stm32/hal/callback.hxx"
+#include "cpp_stm32/utility/format.hxx"
+#include "cpp_stm32/utility/span.hxx"
+#include "cpp_stm32/utility/spsc_ring.hxx"
+
+namespace cpp_stm32::driver {
+
+/**
+ * @class 	BufferedUsart
+ * @brief		Usart that transmits from and receives into ring buffers in TXE / RXNE interrupt, so that neither
+ * 					@ref send nor @ref receive waits for the line.
+ * @tparam	TX 			Tx pin
+ * @tparam	RX 			Rx pin
+ * @tparam	TxSize 	Capacity of transmit ring, power of 2
+ * @tparam	RxSize 	Capacity of receive ring, power of 2, should hold the data arriving between two @ref receive
+ *
+ * @code{.cpp}
+ * 	BufferedUsart<PinName::PA_2, PinName::PA_3> pc{UsartTx_v<PinName::PA_2>, UsartRx_v<PinName::PA_3>, 921600_Baud};
+ * 	pc.start();
+ *
+ * 	std::array<std::uint8_t, 16> cmd{};
+ * 	auto const len = pc.receive(Span{cmd});		// whatever has arrived, possibly nothing
+ * 	pc.send(Span<std::uint8_t const>{cmd.data(), len});
+ * @endcode
+ *
+ * @note 		Each ring has one producer and one consumer, i.e. @ref send and @ref receive must be called from one context
+ * 					(e.g. main loop) only.
+ */
+template <gpio::PinName TX, gpio::PinName RX, std::size_t TxSize = 64, std::size_t RxSize = 64>
+class BufferedUsart {
+ private:
+	static constexpr auto USART_PORT		= UsartTx<TX>::TX_USART_NUM;
+	static constexpr auto USART_IRQ_NUM = UsartTx<TX>::TX_IRQ;
+
+	Usart<TX, RX> m_usart;
+	SpscRing<std::uint8_t, TxSize> m_txRing;
+	SpscRing<std::uint8_t, RxSize> m_rxRing;
+	std::atomic<std::uint32_t> m_dropped{0};
+	std::atomic<bool> m_txActive{false}; /*!< TXE interrupt is enabled, i.e. transmit ring is being drained */
+
+	void irqHandler() noexcept {
+		using usart::InterruptFlag;
+
+		auto const [rxne, ore, txe] =
+			usart::get_interrupt_flag<USART_PORT, InterruptFlag::RXNE, InterruptFlag::ORE, InterruptFlag::TXE>();
+
+		if (rxne != 0 || ore != 0) {
+			// reading DR clears both RXNE and ORE, the byte that ORE refers to is lost already
+			auto const data = static_cast<std::uint8_t>(usart::receive<USART_PORT>());
+
+			auto const lost = std::uint32_t{ore != 0} + std::uint32_t{!m_rxRing.push(data)};
+			if (lost != 0) {
+				m_dropped.store(m_dropped.load(std::memory_order_relaxed) + lost, std::memory_order_relaxed);
+			}
+		}
+
+		// TXE is set whenever DR is empty, it is ours only if transmission is ongoing, otherwise every RX interrupt would
+		// write CR1 to disable the interrupt that is disabled already
+		if (txe != 0 && m_txActive.load(std::memory_order_relaxed)) {
+			if (std::uint8_t data = 0; m_txRing.pop(data)) {
+				usart::send<USART_PORT>(data);
+			} else {
+				m_txActive.store(false, std::memory_order_relaxed);
+				usart::disable_txe_irq<USART_PORT>();
+			}
+		}
+	}
+
+ public:
+	constexpr BufferedUsart(UsartTx<TX> const t_tx, UsartRx<RX> const t_rx, usart::Baudrate_t const t_baud) noexcept
+		: m_usart{t_tx, t_rx, t_baud} {}
+
+	template <std::uint32_t Baud>
+	constexpr BufferedUsart(UsartTx<TX> const t_tx, UsartRx<RX> const t_rx, Frequency<Baud> const t_baud) noexcept
+		: m_usart{t_tx, t_rx, t_baud} {}
+
+	// USART interrupt keeps the address of this object
+	BufferedUsart(BufferedUsart const&) = delete;
+	BufferedUsart& operator=(BufferedUsart const&) = delete;
+
+	/**
+	 * @brief		This function attaches USART interrupt and starts reception
+	 */
+	void start() noexcept {
+		nvic::enable_irq<USART_IRQ_NUM>(Callback<&BufferedUsart::irqHandler>{this});
+		usart::enable_rxne_irq<USART_PORT>();
+	}
+
+	/**
+	 * @brief		This function queues data to be sent, and returns without waiting
+	 * @return	Number of byte queued, less than the size of data if transmit ring is full
+	 */
+	std::size_t send(Span<std::uint8_t const> const t_data) noexcept {
+		auto const count = m_txRing.push(t_data);
+
+		// the interrupt must see the data before the flag is checked, otherwise it may stop with data left in the ring
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+
+		// TXE is set as long as DR is empty, enabling the interrupt kicks off transmission if it is idle
+		if (count != 0 && !m_txActive.load(std::memory_order_relaxed)) {
+			m_txActive.store(true, std::memory_order_relaxed);
+			usart::enable_txe_irq<USART_PORT>();
+		}
+
+		return count;
+	}
+
+	std::size_t send(std::string_view const t_str) noexcept {
+		return send(Span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(t_str.data()), t_str.size()});
+	}
+
+	bool send(std::uint8_t const t_data) noexcept { return send(Span<std::uint8_t const>{&t_data, 1}) == 1; }
+
+	/**
+	 * @brief		This function formats the arguments into one buffer, and queues it as a whole
+	 * @tparam 	Fmt 	Format string, see @ref format
+	 * @return	Number of byte queued, 0 if there isn't enough room in transmit ring
+	 */
+	template <auto const& Fmt, typename... Args>
+	std::size_t print(Args const... t_args) noexcept {
+		auto const str = format<Fmt>(t_args...);
+		return writable() < str.size() ? 0 : send(str.view());
+	}
+
+	/**
+	 * @brief		This function moves the data received so far into buffer, without waiting
+	 * @return	Number of byte received, no more than the size of buffer
+	 */
+	std::size_t receive(Span<std::uint8_t> const t_buf) noexcept { return m_rxRing.pop(t_buf); }
+
+	/**
+	 * @brief		This function returns number of byte received but not read by @ref receive yet
+	 */
+	[[nodiscard]] std::size_t available() const noexcept { return m_rxRing.size(); }
+
+	/**
+	 * @brief		This function returns room left in transmit ring
+	 */
+	[[nodiscard]] std::size_t writable() const noexcept { return TxSize - m_txRing.size(); }
+
+	/**
+	 * @brief		This function returns number of received byte lost due to full receive ring or overrun
+	 */
+	[[nodiscard]] std::uint32_t dropped() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief		This function waits until transmit ring is empty, and the last byte leaves shift register
+	 */
+	void flush() const noexcept {
+		while (!m_txRing.empty()) {
+		}
+
+		while (std::get<0>(usart::get_interrupt_flag<USART_PORT, usart::InterruptFlag::TC>()) == 0) {
+		}
+	}
+};
+
+}	// namespace cpp_stm32::driver
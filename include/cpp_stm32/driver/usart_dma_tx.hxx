@@ -0,0 +1,211 @@
+/**
+ * @file  driver/usart_dma_tx.hxx
+ * @brief	Usart transmit queue served by DMA
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+
+#include "cpp_stm32/hal/callback.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+#include "dma.hxx"
+#include "nvic.hxx"
+#include "pin_map/dma.hxx"
+#include "usart.hxx"
+
+namespace cpp_stm32::driver {
+
+/**
+ * @class 	UsartDmaTx
+ * @brief		Queue of (pointer, length) descriptors sent by DMA, the next message is started from DMA transfer complete
+ * 					interrupt, so that queued messages go out back to back without CPU copying or waiting.
+ * @tparam	USART @ref usart::Port
+ * @tparam	DMA 	@ref dma::Port
+ * @tparam	Str 	@ref dma::Stream
+ * @tparam	Depth Max number of message in queue, including the one being sent
+ *
+ * @code{.cpp}
+ * 	using Streams = dma::StreamAllocator<dma::Use<dma::Request::Usart2Tx>>;
+ * 	constexpr auto TX_DMA = Streams::get<dma::Request::Usart2Tx>();
+ *
+ * 	UsartDmaTx<usart::Port::Usart2, TX_DMA.port, TX_DMA.stream> tx;
+ * 	tx.start(TX_DMA.channel);
+ * 	tx.send("telemetry: ");		// returns immediately
+ * 	tx.send(Span{frame});
+ * @endcode
+ *
+ * @note 		Message is not copied, it must stay unmodified until it is sent, see @ref sentCount. Only one context (e.g.
+ * 					main loop) may call @ref send, the DMA interrupt is the only consumer. Both DMA and USART clock must be
+ * 					enabled, and USART must be configured, e.g. by @ref Usart.
+ */
+template <usart::Port USART, dma::Port DMA, dma::Stream Str, std::size_t Depth = 8>
+class UsartDmaTx {
+ private:
+	static_assert(0 < Depth);
+
+	static constexpr auto IRQ_NUM		 = dma::IrqMap::template getIrqNum<DMA, Str>();
+	static constexpr auto DR_ADDR		 = usart::reg::DR<USART>.memoryAddr();
+	static constexpr auto MAX_LENGTH = std::size_t{0xFFFFU};	// NDTR is 16 bit
+
+	struct Descriptor {
+		std::uint8_t const* data{nullptr};
+		std::uint16_t length{0};
+	};
+
+	std::array<Descriptor, Depth> m_queue{};
+	std::atomic<std::uint32_t> m_queued{0}; /*!< Number of message ever queued, written by sender only */
+	std::atomic<std::uint32_t> m_sent{0};		/*!< Number of message ever sent, written by DMA interrupt only */
+	std::atomic<bool> m_active{false};
+	std::atomic<bool> m_error{false};
+
+	dma::Channel m_channel{dma::Channel::Channel0};
+	dma::StreamPriority m_prior{dma::StreamPriority::Low};
+
+	/**
+	 * @brief		This function starts the message at the head of queue, DMA must be idle
+	 */
+	void startNext() noexcept {
+		auto const& [data, length] = m_queue[m_sent.load(std::memory_order_relaxed) % Depth];
+
+		dma::DmaBuilder<DMA, Str>{}
+			.transferDir(dma::MemoryAddress_t{reinterpret_cast<std::uintptr_t>(data)}, dma::PeriphAddress_t{DR_ADDR})
+			.txDataNum(length)
+			.selectChannel(m_channel)
+			.streamPriority(m_prior)
+			.enableMemIncrement()
+			.template enableInterrupt<dma::InterruptFlag::TCI, dma::InterruptFlag::TEI>()
+			.build();
+	}
+
+	void irqHandler() noexcept {
+		using dma::InterruptFlag;
+
+		auto const [tc_flag, te_flag] = dma::get_interrupt_flag<DMA, Str, InterruptFlag::TCI, InterruptFlag::TEI>();
+		if (tc_flag == 0 && te_flag == 0) {
+			return;
+		}
+
+		dma::clear_interrupt_flag<DMA, Str, InterruptFlag::TCI, InterruptFlag::TEI>();
+
+		if (te_flag != 0) {
+			m_error.store(true, std::memory_order_relaxed);
+		}
+
+		// the message is released to sender even if it failed, there is no retry
+		auto const sent = m_sent.load(std::memory_order_relaxed) + 1;
+		m_sent.store(sent, std::memory_order_release);
+
+		if (sent != m_queued.load(std::memory_order_acquire)) {
+			startNext();
+		} else {
+			m_active.store(false, std::memory_order_release);
+		}
+	}
+
+ public:
+	constexpr UsartDmaTx() noexcept = default;
+
+	// DMA interrupt keeps the address of this object
+	UsartDmaTx(UsartDmaTx const&) = delete;
+	UsartDmaTx& operator=(UsartDmaTx const&) = delete;
+
+	/**
+	 * @brief		This function attaches DMA interrupt and enables USART DMA transmission
+	 * @param 	t_ch 			DMA request channel of USART TX
+	 * @param 	t_prior 	Stream priority
+	 */
+	void start(dma::Channel const t_ch, dma::StreamPriority const t_prior = dma::StreamPriority::Low) noexcept {
+		m_channel = t_ch;
+		m_prior		= t_prior;
+
+		nvic::enable_irq<IRQ_NUM>(Callback<&UsartDmaTx::irqHandler>{this});
+		usart::enable_tx_dma<USART>();
+	}
+
+	/**
+	 * @brief		This function queues message to be sent, and returns without waiting
+	 * @param 	t_msg 	Message, must stay unmodified until it is sent
+	 * @return	false if queue is full or message is longer than 65535 bytes, in which case nothing is queued
+	 */
+	bool send(Span<std::uint8_t const> const t_msg) noexcept {
+		if (t_msg.empty()) {
+			return true;
+		}
+
+		auto const queued = m_queued.load(std::memory_order_relaxed);
+		if (t_msg.size() > MAX_LENGTH || queued - m_sent.load(std::memory_order_acquire) == Depth) {
+			return false;
+		}
+
+		m_queue[queued % Depth] = Descriptor{t_msg.data(), static_cast<std::uint16_t>(t_msg.size())};
+		m_queued.store(queued + 1, std::memory_order_release);
+
+		// if DMA finished the previous message before this one is queued, it is idle now, and needs to be started
+		if (!m_active.exchange(true, std::memory_order_acq_rel)) {
+			startNext();
+		}
+
+		return true;
+	}
+
+	bool send(std::string_view const t_str) noexcept {
+		return send(Span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(t_str.data()), t_str.size()});
+	}
+
+	/**
+	 * @brief		This function returns number of message ever sent, message queued when the count was n is sent once the
+	 * 					count exceeds n
+	 */
+	[[nodiscard]] std::uint32_t sentCount() const noexcept { return m_sent.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief		This function returns number of message in queue, including the one being sent
+	 */
+	[[nodiscard]] std::size_t pending() const noexcept {
+		return m_queued.load(std::memory_order_relaxed) - m_sent.load(std::memory_order_acquire);
+	}
+
+	[[nodiscard]] bool idle() const noexcept { return !m_active.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief		This function returns and clears transfer error status
+	 */
+	[[nodiscard]] bool failed() noexcept { return m_error.exchange(false, std::memory_order_relaxed); }
+
+	/**
+	 * @brief		This function waits until every queued message, including the last byte in shift register, is sent
+	 */
+	void flush() const noexcept {
+		while (!idle()) {
+		}
+
+		while (std::get<0>(usart::get_interrupt_flag<USART, usart::InterruptFlag::TC>()) == 0) {
+		}
+	}
+};
+
+}	// namespace cpp_stm32::driver
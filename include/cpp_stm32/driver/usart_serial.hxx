@@ -17,7 +17,6 @@
 #pragma once
 
 #include <array>
-#include <charconv>
 #include <string_view>
 #include <tuple>
 #include <utility>
@@ -25,8 +24,11 @@
 #include "cpp_stm32/common/usart.hxx"
 #include "cpp_stm32/detail/algorithm.hxx"
 #include "cpp_stm32/driver/gpio_base.hxx"
+#include "cpp_stm32/driver/pin_config.hxx"
 #include "cpp_stm32/hal/callback.hxx"
+#include "cpp_stm32/utility/format.hxx"
 #include "cpp_stm32/utility/serial.hxx"
+#include "cpp_stm32/utility/span.hxx"
 
 // target specific include
 #include "device.hxx"
@@ -80,43 +82,40 @@ class Usart {
 	static constexpr auto USART_GPIO_AF = UsartTx<TX>::TX_AF;
 	static constexpr auto USART_IRQ_NUM = UsartTx<TX>::TX_IRQ;
 
-	static constexpr void USART_IRQ() noexcept {}
+	static constexpr char VALUE_FORMAT[] = "{}";
 
-	// static inline auto USART_CB_ARRAY = std::array<int, 2 /*tx & rx*/>{};
+	/**
+	 * @brief   	This function sends the characters one after another, polling for transmit readiness in between, i.e. it
+	 * 						returns after the last character is in DR. Use @ref BufferedUsart or @ref UsartDmaTx to send without
+	 * 						blocking
+	 */
+	constexpr void sendEachBlocking(std::string_view const t_str) const noexcept {
+		for (auto const& val : t_str) {
+			usart::send_blocking<USART_PORT>(static_cast<std::uint8_t>(val));
+		}
+	}
 
 	/**
 	 * @brief   	This function convert arithmetic type to string and output to usart
-	 * @param 		t_val Value to print
-	 *
-	 * @note  		floating point is not supported due to gcc hasn't implemented yet
+	 * @param 		t_val Value to print, floating point is printed with 6 digits after decimal point, see @ref format
 	 */
 	template <typename T>
 	constexpr void printValAsStr(T const t_val) const noexcept {
-		constexpr auto BUFFER_SIZE = 10;
-		std::array<char, BUFFER_SIZE> str{};
-
-		if (auto [p, ec] = std::to_chars(str.data(), str.data() + str.size(), t_val); ec == std::errc()) {
-			auto const result = std::string_view(str.data(), p - str.data());
-			detail::for_each(result.begin(), result.end(),
-											 [](char const val) { usart::send_blocking<USART_PORT>(static_cast<std::uint8_t>(val)); });
-		}
+		sendEachBlocking(format<VALUE_FORMAT>(t_val).view());
 	}
 
- public:
-	explicit constexpr Usart(usart::Baudrate_t const t_baud) noexcept {}
-
-	explicit constexpr Usart(UsartTx<TX> const /*unused*/, UsartRx<RX> const /*unused*/,
-													 usart::Baudrate_t const t_baud) noexcept {
-		using gpio::Pupd;
-		using usart::StopBit_v, usart::DataBit, usart::Parity, usart::HardwareFlowControl, usart::Stopbit;
-
+	static constexpr void setupPin() noexcept {
 		rcc::enable_periph_clk<USART_RCC>();
 
+		check_board_pins<PinDecls>();
 		GpioUtil<TX, RX>::enableAllGpioClk();
-		GpioUtil<TX, RX>::modeSetup(gpio::Mode::AltFunc, Pupd::PullUp);
+		GpioUtil<TX, RX>::modeSetup(gpio::Mode::AltFunc, gpio::Pupd::PullUp);
 		GpioUtil<TX, RX>::alternateFuncSetup(USART_GPIO_AF);
+	}
+
+	static constexpr void setupFrame() noexcept {
+		using usart::StopBit_v, usart::DataBit, usart::Parity, usart::HardwareFlowControl, usart::Stopbit;
 
-		usart::set_baudrate<USART_PORT>(t_baud);
 		usart::set_dps<USART_PORT>(DataBit::DataBit8, Parity::None, StopBit_v<Stopbit::Bit1>);
 
 		usart::set_transfer_mode<USART_PORT>(usart::TransferMode::TxRx);
@@ -125,6 +124,37 @@ class Usart {
 		usart::enable<USART_PORT>();
 	}
 
+ public:
+	/**
+	 * @brief		Pins set up by constructor, see @ref BoardPinConfig
+	 */
+	using PinDecls = PinDeclList<PinDecl<TX, gpio::Mode::AltFunc, gpio::Pupd::PullUp, USART_GPIO_AF>,
+															 PinDecl<RX, gpio::Mode::AltFunc, gpio::Pupd::PullUp, USART_GPIO_AF>>;
+
+	explicit constexpr Usart(usart::Baudrate_t const t_baud) noexcept {}
+
+	/**
+	 * @param 	t_baud 	Baudrate that is only known at runtime, prefer compile time baudrate, e.g. 921600_Hz
+	 */
+	explicit constexpr Usart(UsartTx<TX> const /*unused*/, UsartRx<RX> const /*unused*/,
+													 usart::Baudrate_t const t_baud) noexcept {
+		setupPin();
+		usart::set_baudrate<USART_PORT>(t_baud);
+		setupFrame();
+	}
+
+	/**
+	 * @tparam 	Baud 	Baudrate, oversampling and BRR are calculated at compile time, and compilation fails if the baudrate can't
+	 * 								be reached within @ref usart::BAUDRATE_TOLERANCE_PPM
+	 */
+	template <std::uint32_t Baud>
+	explicit constexpr Usart(UsartTx<TX> const /*unused*/, UsartRx<RX> const /*unused*/,
+													 Frequency<Baud> const t_baud) noexcept {
+		setupPin();
+		usart::set_baudrate<USART_PORT>(t_baud);
+		setupFrame();
+	}
+
 	constexpr auto sendable() const noexcept { return usart::is_tx_empty<USART_PORT>(); }
 
 	constexpr auto receivable() const noexcept { return usart::is_rx_empty<USART_PORT>(); }
@@ -147,9 +177,14 @@ class Usart {
 		}
 	}
 
-	constexpr void send(std::string_view const t_str) const noexcept {
-		for (auto const& val : t_str) {
-			usart::send_blocking<USART_PORT>(static_cast<std::uint8_t>(val));
+	constexpr void send(std::string_view const t_str) const noexcept { sendEachBlocking(t_str); }
+
+	/**
+	 * @brief   	This function sends raw bytes, e.g. record of @ref log::DeferredLogger
+	 */
+	constexpr void send(Span<std::uint8_t const> const t_data) const noexcept {
+		for (auto const val : t_data) {
+			usart::send_blocking<USART_PORT>(val);
 		}
 	}
 
@@ -160,6 +195,20 @@ class Usart {
 		}
 	}
 
+	/**
+	 * @brief   	This function formats the arguments into one buffer, and sends it character by character, blocking
+	 * @tparam 		Fmt 	Format string, constexpr char array with static storage duration, see @ref format
+	 *
+	 * @code{.cpp}
+	 * 	static constexpr char POSE[] = "x={} y={:.3f}\r\n";
+	 * 	pc.print<POSE>(x, y);
+	 * @endcode
+	 */
+	template <auto const& Fmt, typename... Args>
+	constexpr void print(Args const... t_args) const noexcept {
+		sendEachBlocking(format<Fmt>(t_args...).view());
+	}
+
 	template <typename T, typename = std::enable_if_t<!std::is_pointer_v<T>>>
 	constexpr auto operator<<(T const t_val) const noexcept {
 		if constexpr (std::is_same_v<T, char>) {
@@ -172,10 +221,7 @@ class Usart {
 	}
 
 	constexpr auto operator<<(std::string_view const t_str) const noexcept {
-		for (auto const& val : t_str) {
-			usart::send_blocking<USART_PORT>(static_cast<std::uint8_t>(val));
-		}
-
+		sendEachBlocking(t_str);
 		return *this;
 	}
 
@@ -188,11 +234,15 @@ class Usart {
 		return *this;
 	}
 
+	/**
+	 * @brief		This function attaches USART interrupt and enables TXE interrupt
+	 * @param 	t_cb 	Callback called in USART interrupt, it has to check which flag is set, see @ref BufferedUsart for
+	 * 								interrupt driven transmission and reception that is ready to use
+	 */
 	template <auto F>
 	constexpr void attachTxeIRQ(Callback<F> const& t_cb) const noexcept {
-		nvic::enable_irq<USART_IRQ_NUM>(Callback<USART_IRQ>{});
+		nvic::enable_irq<USART_IRQ_NUM>(t_cb);
 		usart::enable_txe_irq<USART_PORT>();
-		// register callback to callback array
 	}
 };
 
@@ -32,7 +32,7 @@ enum class IrqNum : std::uint8_t;
 template <auto F>
 struct Callback;
 
-template <typename OwnerT, void (OwnerT::*F)()>
+template <typename OwnerT, void (OwnerT::*F)() noexcept>
 class Callback<F> {
 	using MethodHolder = OwnerT;
 
@@ -0,0 +1,263 @@
+/**
+ * @file  hal/host_mmio.hxx
+ * @brief	Simulated memory mapped io, used to run and measure drivers off target
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <utility>
+
+namespace cpp_stm32 {
+
+/**
+ * @class 	HostMmio
+ * @brief		MMIO backend that maps peripheral address to a simulated register file, and counts the read and write of
+ * 					each register per access width. Define CPP_STM32_HOST_MMIO to use it, e.g.
+ *
+ * @code{.cpp}
+ * 	HostMmio::poke(usart::reg::SR<Usart2>.memoryAddr(), 1U << 7);	// TXE
+ * 	usart::send_blocking<Usart2>('a');
+ * 	auto const [read, write] = HostMmio::accessCount(usart::reg::DR<Usart2>.memoryAddr(), sizeof(std::uint8_t));
+ * @endcode
+ *
+ * @note 		The register file is byte addressed (little endian), therefore mixed width access behaves the same as on
+ * 					target. Bit banding alias access (Cortex-M3/M4) is redirected to the corresponding bit, but counted as the
+ * 					access of alias address. Hardware side effect (e.g. status flag cleared by reading) can be emulated by
+ * 					@ref onRead and @ref onWrite hook.
+ */
+class HostMmio {
+ public:
+	/**
+	 * @class 	AccessCount
+	 * @brief		Number of read and write of a register
+	 */
+	struct AccessCount {
+		std::size_t read{0};
+		std::size_t write{0};
+	};
+
+	using ReadHook	= std::function<std::uint32_t(std::uint32_t)>;
+	using WriteHook = std::function<void(std::uint32_t)>;
+
+ private:
+	using AccessKey = std::pair<std::uint32_t, std::size_t>; /*!< (address, access width in byte) */
+
+	static inline std::map<std::uint32_t, std::uint8_t> m_registerFile{};
+	static inline std::map<AccessKey, AccessCount> m_accessCount{};
+	static inline std::map<std::uint32_t, ReadHook> m_readHook{};
+	static inline std::map<std::uint32_t, WriteHook> m_writeHook{};
+
+	static constexpr std::uint32_t BIT_BAND_ALIAS_OFFSET = 0x0200'0000U;
+	static constexpr std::uint32_t BIT_BAND_ALIAS_SIZE	 = 0x0200'0000U;
+
+	/**
+	 * @brief		This function returns (word address, bit) that the bit banding alias address refers to, or nothing if it is
+	 * 					not an alias address.
+	 */
+	static constexpr std::optional<std::pair<std::uint32_t, std::uint32_t>> aliasOf(std::uint32_t const t_addr) noexcept {
+		for (std::uint32_t const region : {0x2000'0000U, 0x4000'0000U}) {
+			auto const alias_base = region + BIT_BAND_ALIAS_OFFSET;
+			if (alias_base <= t_addr && t_addr < alias_base + BIT_BAND_ALIAS_SIZE) {
+				auto const offset = t_addr - alias_base;
+				return std::pair{region + (offset / 32U) / 4U * 4U, (offset / 32U) % 4U * 8U + (offset % 32U) / 4U};
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	template <typename T>
+	static auto peekAs(std::uint32_t const t_addr) noexcept {
+		T ret_val{0};
+		for (std::uint32_t i = 0; i < sizeof(T); ++i) {
+			auto const iter = m_registerFile.find(t_addr + i);
+			ret_val |= static_cast<T>((iter != m_registerFile.end() ? iter->second : 0U) << (8U * i));
+		}
+
+		return ret_val;
+	}
+
+	template <typename T>
+	static void pokeAs(std::uint32_t const t_addr, T const t_val) noexcept {
+		for (std::uint32_t i = 0; i < sizeof(T); ++i) {
+			m_registerFile[t_addr + i] = static_cast<std::uint8_t>(t_val >> (8U * i));
+		}
+	}
+
+ public:
+	/**
+	 * @class 	Ref
+	 * @brief		Proxy of memory mapped io, every conversion to T counts as one read, every assignment counts as one
+	 * 					write, compound assignment counts as one read and one write.
+	 */
+	template <typename T>
+	class Ref {
+	 private:
+		std::uint32_t const m_addr;
+
+	 public:
+		explicit constexpr Ref(std::uint32_t const t_addr) noexcept : m_addr(t_addr) {}
+
+		[[nodiscard]] T load() const noexcept { return HostMmio::read<T>(m_addr); }
+
+		operator T() const noexcept { return load(); }	// NOLINT: implicit conversion mimics volatile T&
+
+		Ref const& operator=(T const t_val) const noexcept {
+			HostMmio::write<T>(m_addr, t_val);
+			return *this;
+		}
+
+		Ref const& operator|=(T const t_val) const noexcept { return *this = static_cast<T>(load() | t_val); }
+		Ref const& operator&=(T const t_val) const noexcept { return *this = static_cast<T>(load() & t_val); }
+	};
+
+	template <typename T>
+	static constexpr auto access(std::uint32_t const t_addr) noexcept {
+		return Ref<T>{t_addr};
+	}
+
+	/**
+	 * @brief		This function reads the register file as the MCU does, i.e. counted and hooked
+	 */
+	template <typename T>
+	static T read(std::uint32_t const t_addr) noexcept {
+		++m_accessCount[AccessKey{t_addr, sizeof(T)}].read;
+
+		if (auto const alias = aliasOf(t_addr); alias.has_value()) {
+			auto const [word_addr, bit] = *alias;
+			return static_cast<T>((peekAs<std::uint32_t>(word_addr) >> bit) & 1U);
+		}
+
+		if (auto const hook = m_readHook.find(t_addr); hook != m_readHook.end()) {
+			pokeAs<T>(t_addr, static_cast<T>(hook->second(peekAs<T>(t_addr))));
+		}
+
+		return peekAs<T>(t_addr);
+	}
+
+	/**
+	 * @brief		This function writes the register file as the MCU does, i.e. counted and hooked
+	 */
+	template <typename T>
+	static void write(std::uint32_t const t_addr, T const t_val) noexcept {
+		++m_accessCount[AccessKey{t_addr, sizeof(T)}].write;
+
+		if (auto const alias = aliasOf(t_addr); alias.has_value()) {
+			auto const [word_addr, bit] = *alias;
+			auto const word_val					= (peekAs<std::uint32_t>(word_addr) & ~(1U << bit)) | ((t_val & 1U) << bit);
+			pokeAs<std::uint32_t>(word_addr, word_val);
+
+			if (auto const hook = m_writeHook.find(word_addr); hook != m_writeHook.end()) {
+				hook->second(word_val);
+			}
+
+			return;
+		}
+
+		pokeAs<T>(t_addr, t_val);
+
+		if (auto const hook = m_writeHook.find(t_addr); hook != m_writeHook.end()) {
+			hook->second(t_val);
+		}
+	}
+
+	/**
+	 * @brief		This function sets the value of register without being counted, e.g. to emulate hardware status flag
+	 */
+	static void poke(std::uint32_t const t_addr, std::uint32_t const t_val) noexcept { pokeAs(t_addr, t_val); }
+
+	/**
+	 * @brief		This function gets the value of register without being counted
+	 */
+	[[nodiscard]] static auto peek(std::uint32_t const t_addr) noexcept { return peekAs<std::uint32_t>(t_addr); }
+
+	/**
+	 * @brief		This function registers a hook that is called before the register is read, the return value of the
+	 * 					hook becomes the new register value
+	 */
+	static void onRead(std::uint32_t const t_addr, ReadHook t_hook) noexcept { m_readHook[t_addr] = std::move(t_hook); }
+
+	/**
+	 * @brief		This function registers a hook that is called after the register is written
+	 */
+	static void onWrite(std::uint32_t const t_addr, WriteHook t_hook) noexcept {
+		m_writeHook[t_addr] = std::move(t_hook);
+	}
+
+	/**
+	 * @brief		This function returns the number of access of a register with specific width
+	 * @param 	t_addr 		Address of the register, see @ref Register::memoryAddr
+	 * @param 	t_width 	Access width in byte
+	 */
+	[[nodiscard]] static auto accessCount(std::uint32_t const t_addr, std::size_t const t_width) noexcept {
+		auto const iter = m_accessCount.find(AccessKey{t_addr, t_width});
+		return iter != m_accessCount.end() ? iter->second : AccessCount{};
+	}
+
+	/**
+	 * @brief		This function returns the number of access of a register, regardless of access width
+	 */
+	[[nodiscard]] static auto accessCount(std::uint32_t const t_addr) noexcept {
+		AccessCount ret_val{};
+		for (auto const& [key, count] : m_accessCount) {
+			if (key.first == t_addr) {
+				ret_val.read += count.read;
+				ret_val.write += count.write;
+			}
+		}
+
+		return ret_val;
+	}
+
+	/**
+	 * @brief		This function returns the number of all bus transactions
+	 */
+	[[nodiscard]] static auto totalAccessCount() noexcept {
+		AccessCount ret_val{};
+		for (auto const& [key, count] : m_accessCount) {
+			ret_val.read += count.read;
+			ret_val.write += count.write;
+		}
+
+		return ret_val;
+	}
+
+	/**
+	 * @brief		This function clears the access counter, the register file and hooks are kept
+	 */
+	static void resetCount() noexcept { m_accessCount.clear(); }
+
+	/**
+	 * @brief		This function clears everything, i.e. counter, register file and hooks
+	 */
+	static void reset() noexcept {
+		m_registerFile.clear();
+		m_accessCount.clear();
+		m_readHook.clear();
+		m_writeHook.clear();
+	}
+};
+
+}	// namespace cpp_stm32
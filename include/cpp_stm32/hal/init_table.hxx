@@ -0,0 +1,139 @@
+/**
+ * @file  hal/init_table.hxx
+ * @brief	Peripheral initialization described as table of register access, built at compile time
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "cpp_stm32/hal/mmio.hxx"
+
+/**
+ * Initialization sequence is usually a long list of register write and status polling, each of which is inlined into
+ * its own load/modify/store (or polling loop) by @ref Register. Describing the sequence as table instead, all values
+ * are computed at compile time, placed in flash as 16 bytes per record, and replayed by one loop, e.g.
+ *
+ * @code{.cpp}
+ * 	static constexpr auto table = init::make_table(
+ * 		init::write(rcc::reg::CR.modify().template setBit<rcc::reg::CrBit::HseOn>()),
+ * 		init::wait_until<rcc::reg::CrBit::HseRdy>(rcc::reg::CR),
+ * 		init::write(rcc::reg::CFGR.modify().template writeBit<rcc::reg::CfgBit::SW>(rcc::SysClk::Hse)));
+ *
+ * 	init::run(table);
+ * @endcode
+ *
+ * @note 		Every record is replayed by word access, and modification is not atomic, i.e. this is meant for boot time
+ * 					initialization, before interrupt is enabled. @ref CachedRegister can't be written by table, since its
+ * 					shadow isn't updated.
+ */
+namespace cpp_stm32::init {
+
+enum class Op : std::uint32_t {
+	Store,	/*!< register = value */
+	Modify, /*!< register = (register & mask) | value */
+	Poll,		/*!< wait until (register & mask) == value */
+};
+
+struct Record {
+	std::uint32_t addr{0};
+	std::uint32_t mask{0};
+	std::uint32_t value{0};
+	Op op{Op::Store};
+};
+
+static_assert(sizeof(Record) == 16);
+
+template <std::size_t N>
+using Table = std::array<Record, N>;
+
+/**
+ * @brief		This function records the store of modification
+ * @param 	t_mod 	Modification of register, see @ref Register::modify
+ * @return	Table of single record
+ */
+template <typename Modification>
+[[nodiscard]] constexpr auto write(Modification const& t_mod) noexcept {
+	auto const [addr, keep_mask, value] = t_mod.storeInfo();
+	return Table<1>{Record{addr, keep_mask, value, keep_mask == 0U ? Op::Store : Op::Modify}};
+}
+
+/**
+ * @brief		This function records the polling of status bits
+ * @tparam	BitIdx 	Bits to be polled
+ * @param 	t_reg 	Register that contains the bits
+ * @param 	t_val 	Expected value of the bits, see @ref Register::condition
+ * @return	Table of single record
+ */
+template <auto... BitIdx, typename Reg, typename... ValueTypes>
+[[nodiscard]] constexpr auto wait_until(Reg const& t_reg, ValueTypes const... t_val) noexcept {
+	auto const [mask, value] = Reg::template condition<BitIdx...>(t_val...);
+	return Table<1>{Record{t_reg.memoryAddr(), mask, value, Op::Poll}};
+}
+
+/**
+ * @brief		This function concatenates records and tables into one table
+ */
+template <std::size_t... N>
+[[nodiscard]] constexpr auto make_table(Table<N> const&... t_tables) noexcept {
+	Table<(0 + ... + N)> ret_val{};
+	std::size_t idx = 0;
+
+	auto const append = [&](auto const& t_table) {
+		for (auto const& record : t_table) {
+			ret_val[idx++] = record;
+		}
+	};
+
+	(append(t_tables), ...);
+	return ret_val;
+}
+
+/**
+ * @brief		This function replays the records in order
+ * @note 		Not a template, so there is only one copy of the loop no matter how many tables there are
+ */
+inline void run(Record const* t_first, Record const* const t_last) noexcept {
+	for (; t_first != t_last; ++t_first) {
+		auto const& [addr, mask, value, op] = *t_first;
+
+		switch (op) {
+			case Op::Store:
+				MMIO32(addr, 0) = value;
+				break;
+			case Op::Modify:
+				MMIO32(addr, 0) = (mmio_load(MMIO32(addr, 0)) & mask) | value;
+				break;
+			case Op::Poll:
+				while ((mmio_load(MMIO32(addr, 0)) & mask) != value) {
+				}
+				break;
+		}
+	}
+}
+
+template <std::size_t N>
+void run(Table<N> const& t_table) noexcept {
+	run(t_table.data(), t_table.data() + N);
+}
+
+}	// namespace cpp_stm32::init
@@ -23,19 +23,69 @@
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
 
 #include "cpp_stm32/utility/utility.hxx"
 
 namespace cpp_stm32 {
 
+/**
+ * @class 	TargetMmio
+ * @brief		Default MMIO backend, memory mapped io is accessed through volatile pointer, this is what the MCU needs.
+ */
+struct TargetMmio {
+	template <typename T>
+	static constexpr decltype(auto) access(std::uint32_t const t_addr) noexcept {
+		return *reinterpret_cast<volatile T*>(t_addr);
+	}
+};
+
+}	// namespace cpp_stm32
+
+#if defined(CPP_STM32_HOST_MMIO)
+#include "cpp_stm32/hal/host_mmio.hxx"
+#endif
+
+namespace cpp_stm32 {
+
+/**
+ * @brief		MMIO backend used by the library, selected at compile time:
+ * 						- CPP_STM32_MMIO_BACKEND: user provided backend, see @ref TargetMmio for the interface
+ * 						- CPP_STM32_HOST_MMIO: simulated register file, see @ref HostMmio
+ * 						- otherwise: @ref TargetMmio
+ */
+#if defined(CPP_STM32_MMIO_BACKEND)
+using MmioBackend = CPP_STM32_MMIO_BACKEND;
+#elif defined(CPP_STM32_HOST_MMIO)
+using MmioBackend = HostMmio;
+#else
+using MmioBackend = TargetMmio;
+#endif
+
 // use enum class and self defined operator can deal with the problem easily
-template <typename T>
+template <typename T, typename Backend = MmioBackend>
 constexpr decltype(auto) MMIO(std::uint32_t addr, std::uint32_t const offset) noexcept {
-	return *reinterpret_cast<volatile T*>(addr + offset);
+	return Backend::template access<T>(addr + offset);
 }
 
 static constexpr auto const MMIO32 = MMIO<std::uint32_t>;
 static constexpr auto const MMIO16 = MMIO<std::uint16_t>;
 static constexpr auto const MMIO8	= MMIO<std::uint8_t>;
 
+/**
+ * @brief		This function reads the value of memory mapped io exactly once
+ * @param 	t_io 	Return value of @ref MMIO
+ * @return 	Value of memory mapped io
+ *
+ * @note 		Backend other than @ref TargetMmio returns proxy object, which must provide load() function
+ */
+template <typename Io>
+[[nodiscard]] constexpr auto mmio_load(Io&& t_io) noexcept {
+	if constexpr (std::is_volatile_v<std::remove_reference_t<Io>>) {
+		return std::remove_cv_t<std::remove_reference_t<Io>>{t_io};
+	} else {
+		return t_io.load();
+	}
+}
+
 }	// namespace cpp_stm32
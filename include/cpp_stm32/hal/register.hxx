@@ -92,6 +92,26 @@ struct DefaultIdxPolicy {
  */
 static constexpr auto DEFAULT_ACCESS = Access::Word | Access::HalfWord | Access::Byte;
 
+/**
+ * @class 	HwModified
+ * @brief		List of read/write bits that are modified by hardware as well, e.g. enable bit that is cleared by hardware
+ * 					at the end of transfer, see @ref CachedRegister
+ */
+template <auto... BitIdx>
+struct HwModified {};
+
+/**
+ * @class 	SelfClearing
+ * @brief		List of read/write bits that are set by software to trigger an operation, and cleared by hardware once the
+ * 					operation is done, e.g. send break, see @ref CachedRegister
+ */
+template <auto... BitIdx>
+struct SelfClearing {};
+
+template <typename BitList, typename BitListIdx, Access IoOp = DEFAULT_ACCESS, typename HwMod = HwModified<>,
+					typename SelfClr = SelfClearing<>, typename IdxPolicy = DefaultIdxPolicy<BitListIdx>>
+class CachedRegister;
+
 /**
  * @class 	Register
  * @brief		This class is abstraction of register.
@@ -106,6 +126,9 @@ template <typename BitList, typename BitListIdx, Access IoOp = DEFAULT_ACCESS, b
 					typename IdxPolicy = DefaultIdxPolicy<BitListIdx>>
 class Register {
  private:
+	template <typename, typename, Access, typename, typename, typename>
+	friend class CachedRegister;
+
 	template <BitListIdx Idx>
 	static constexpr auto GET_BIT = get_bit<BitList, IdxPolicy::TO_IDX(Idx)>;
 
@@ -180,8 +203,8 @@ class Register {
 
 			return mmio(m_base + m_offset, to_underlying(TSIo) * idx);
 		} else {
-			// note: not sure if there is performance difference regarding the speed
-			//  		 of byte, half word, word access.
+			// note: read-modify-write is done by the widest access, bits that can be written without reading are written
+			//  		 by the narrowest access instead, see writeMasked and isolatedAccess.
 
 			// note: The following code generate this kind of strange op:
 			//
@@ -240,12 +263,11 @@ class Register {
 	}
 
 	/**
-	 * @brief			This function read register value if necessary
+	 * @brief			This function checks whether the register value is needed to modify the bits
 	 * @tparam  	BitIdx	Variadic template parameter that contains the positions of bits.
-	 * @return		If reading register is necessary, then return the value of the register, otherwise return 0.
 	 */
-	template <BitListIdx... BitIdx, bool NeedTS = false, Access TSIo = Access::None>
-	constexpr decltype(auto) readCurrentVal(ThreadSafe<NeedTS, TSIo> const t_ts = NoThreadSafe) const noexcept {
+	template <BitListIdx... BitIdx>
+	static constexpr auto isReadNeeded() noexcept {
 		constexpr auto num_of_bit_to_mod = []() {
 			auto arr = std::array{BitIdx...};
 			detail::sort(arr, [](auto rhs, auto lhs) { return (to_underlying(rhs) < to_underlying(lhs)); });
@@ -267,9 +289,65 @@ class Register {
 			return (!(bit.MOD == BitMod::WrOnly) && !(bit.MOD == BitMod::RdSet));
 		};
 
-		if constexpr ((need_to_read_current_val(GET_BIT<BitIdx>()) && ...) &&
-									!(num_of_bit_to_mod == BitList::WRITABLE_BIT_NUM) && !(BitList::LIST_SIZE == 1)) {
-			return readReg<BitIdx...>(t_ts);
+		return (need_to_read_current_val(GET_BIT<BitIdx>()) && ...) && !(num_of_bit_to_mod == BitList::WRITABLE_BIT_NUM) &&
+					 !(BitList::LIST_SIZE == 1);
+	}
+
+	/**
+	 * @brief			This function returns the mask of bits in the register that have specific @ref BitMod
+	 */
+	template <BitMod Mod, std::size_t... Idx>
+	static constexpr auto maskOfBitMod(std::index_sequence<Idx...> const /*unused*/) noexcept {
+		return (0U | ... | (decltype(get_bit<BitList, Idx>())::MOD == Mod ? get_bit<BitList, Idx>().mask : 0U));
+	}
+
+	/**
+	 * @brief			This function returns the mask of all bits declared in the bit list
+	 */
+	template <std::size_t... Idx>
+	static constexpr auto maskOfDeclaredBit(std::index_sequence<Idx...> const /*unused*/) noexcept {
+		return (0U | ... | get_bit<BitList, Idx>().mask);
+	}
+
+	/**
+	 * @brief		This function finds the narrowest access unit (byte, then half word) that contains all the bits to be
+	 * 					written, and no other read/write bit, so that the bits can be written by single store without reading.
+	 * @tparam	BitIdx	Bits to be written
+	 * @return	std::pair of access (Access::None if no such unit, or not allowed by Access flag) and byte offset.
+	 */
+	template <BitListIdx... BitIdx>
+	static constexpr auto isolatedAccess() noexcept {
+		constexpr std::uint32_t mod_mask	= (GET_BIT<BitIdx>().mask | ...);
+		constexpr std::uint32_t keep_mask = maskOfBitMod<BitMod::RdWr>(std::make_index_sequence<BitList::LIST_SIZE>{}) &
+																				~mod_mask;
+
+		// bits not declared in the bit list may be read/write bits not implemented yet, e.g. enable bits of RCC
+		constexpr std::uint32_t undeclared_mask = ~maskOfDeclaredBit(std::make_index_sequence<BitList::LIST_SIZE>{});
+
+		for (auto const io : {Access::Byte, Access::HalfWord}) {
+			auto const width		 = 8U * static_cast<std::uint32_t>(to_underlying(io));
+			auto const unit_mask = static_cast<std::uint32_t>((1ULL << width) - 1U);
+
+			for (std::uint32_t offset = 0U; offset < 32U; offset += width) {
+				if ((IoOp & io) == io && (mod_mask & ~(unit_mask << offset)) == 0U &&
+						((keep_mask | undeclared_mask) & (unit_mask << offset)) == 0U) {
+					return std::pair{io, offset / 8U};
+				}
+			}
+		}
+
+		return std::pair{Access::None, 0U};
+	}
+
+	/**
+	 * @brief			This function read register value if necessary
+	 * @tparam  	BitIdx	Variadic template parameter that contains the positions of bits.
+	 * @return		If reading register is necessary, then return the value of the register, otherwise return 0.
+	 */
+	template <BitListIdx... BitIdx, bool NeedTS = false, Access TSIo = Access::None>
+	constexpr decltype(auto) readCurrentVal(ThreadSafe<NeedTS, TSIo> const t_ts = NoThreadSafe) const noexcept {
+		if constexpr (isReadNeeded<BitIdx...>()) {
+			return mmio_load(readReg<BitIdx...>(t_ts));
 		} else {
 			return 0;
 		}
@@ -288,6 +366,43 @@ class Register {
 		}
 	}
 
+	/**
+	 * @brief		This function writes bits without being interrupted, i.e. single store to bit banding alias for single
+	 * 					bit, exclusive access for the rest.
+	 * @note 		Implemented by processor, e.g. processor/cortex_m4/bit_banding.hxx
+	 */
+	template <BitListIdx... BitIdx>
+	constexpr void atomicWriteMasked(std::uint32_t const t_val) const noexcept;
+
+	/**
+	 * @brief		This function writes bits with value that is already shifted to the right position, the register is read
+	 * 					only if necessary, see @ref readCurrentVal
+	 * @tparam	BitIdx	Bits to be written
+	 * @param 	t_val 	Value of the bits
+	 */
+	template <BitListIdx... BitIdx>
+	constexpr void writeMasked(std::uint32_t const t_val) const noexcept {
+		constexpr auto isolated = isolatedAccess<BitIdx...>();
+
+		// Bits that share neither byte nor half word with other read/write bits are written by single strb/strh, i.e.
+		// 2 instructions (mov, strb) and 1 bus access, instead of 4 instructions (ldr, bic, orr, str) and 2 bus access,
+		// the load of which stalls the pipeline until the peripheral bus responds.
+		if constexpr (isReadNeeded<BitIdx...>() && isolated.first == Access::Byte) {
+			MMIO8(m_base + m_offset, isolated.second) = static_cast<std::uint8_t>(t_val >> (8U * isolated.second));
+		} else if constexpr (isReadNeeded<BitIdx...>() && isolated.first == Access::HalfWord) {
+			MMIO16(m_base + m_offset, isolated.second) = static_cast<std::uint16_t>(t_val >> (8U * isolated.second));
+		} else if constexpr (atomicity) {
+			atomicWriteMasked<BitIdx...>(t_val);
+		} else {
+			using AccessType = decltype(mmio_load(readReg<BitIdx...>()));
+
+			constexpr std::uint32_t clear_mask = ~(GET_BIT<BitIdx>().mask | ...);
+			auto const current_val						 = static_cast<std::uint32_t>(readCurrentVal<BitIdx...>());
+
+			readReg<BitIdx...>() = static_cast<AccessType>((current_val & clear_mask) | t_val);
+		}
+	}
+
  public:
 	/**
 	 *	@brief	This function is a IsolateFrom_t factory
@@ -315,7 +430,7 @@ class Register {
 	constexpr void setBit() const noexcept {
 		static_assert(((GET_BIT<BitIdx>().LENGTH == 1) && ...));
 
-		readReg<BitIdx...>() |= (GET_BIT<BitIdx>().mask | ...);
+		writeMasked<BitIdx...>((GET_BIT<BitIdx>().mask | ...));
 	}
 
 	/**
@@ -330,12 +445,7 @@ class Register {
 		static_assert((GET_BIT<BitIdx>().template isTypeAvailable<ValueType>() && ...));
 		static_assert((GET_BIT<BitIdx>().isWritable() && ...));
 
-		auto const current_val = readCurrentVal<BitIdx...>();
-
-		auto const mod_val				= (... | GET_BIT<BitIdx>()(t_param));
-		constexpr auto clear_mask = ~(... | GET_BIT<BitIdx>().mask);
-
-		readReg<BitIdx...>() = ((current_val & clear_mask) | mod_val);
+		writeMasked<BitIdx...>(static_cast<std::uint32_t>((... | GET_BIT<BitIdx>()(t_param))));
 	}
 
 	/**
@@ -351,18 +461,13 @@ class Register {
 		static_assert((GET_BIT<BitIdx>().template isTypeAvailable<ValueTypes>() && ...));
 		static_assert((GET_BIT<BitIdx>().isWritable() && ...));
 
-		constexpr auto mod_val_for_each_bit = [](auto const& t_bit_idx, auto const& t_p) {
+		constexpr auto mod_val_for_each_bit = [](auto const t_bit_idx, auto const& t_p) {
 			constexpr auto bit		= GET_BIT<t_bit_idx()>();
 			auto const val_to_mod = std::get<bitIdxOrder<t_bit_idx(), BitIdx...>()>(t_p);
 			return bit(val_to_mod);
 		};
 
-		auto const current_val = readCurrentVal<BitIdx...>();
-
-		auto const mod_val				= (... | mod_val_for_each_bit(BitIdx_c<BitIdx>{}, t_param));
-		constexpr auto clear_mask = ~(... | GET_BIT<BitIdx>().mask);
-
-		readReg<BitIdx...>() = ((current_val & clear_mask) | mod_val);
+		writeMasked<BitIdx...>(static_cast<std::uint32_t>((... | mod_val_for_each_bit(BitIdx_c<BitIdx>{}, t_param))));
 	}
 
 	/**
@@ -376,12 +481,7 @@ class Register {
 		static_assert((GET_BIT<BitIdx>().template isTypeAvailable<ValueTypes>() && ...));
 		static_assert((GET_BIT<BitIdx>().isWritable() && ...));
 
-		auto const current_val = readCurrentVal<BitIdx...>();
-
-		auto const mod_val				= (... | GET_BIT<BitIdx>()(t_param));
-		constexpr auto clear_mask = ~(... | GET_BIT<BitIdx>().mask);
-
-		readReg<BitIdx...>() = ((current_val & clear_mask) | mod_val);
+		writeMasked<BitIdx...>(static_cast<std::uint32_t>((... | GET_BIT<BitIdx>()(t_param))));
 	}
 
 	/**
@@ -399,17 +499,19 @@ class Register {
 		static_assert(sizeof...(Avoid) != 0);
 		constexpr auto thread_safety = ThreadSafe<true, getThreadSafeAccess<BitIdx...>(t_is)>{};
 
-		constexpr auto mod_val_for_each_bit = [](auto const& t_bit_idx, auto const& t_p) {
+		constexpr auto mod_val_for_each_bit = [](auto const t_bit_idx, auto const& t_p) {
 			constexpr auto bit		= GET_BIT<t_bit_idx()>();
 			auto const val_to_mod = std::get<bitIdxOrder<t_bit_idx(), BitIdx...>()>(t_p);
 			return bit(val_to_mod);
 		};
 
-		auto const current_val		= readCurrentVal<BitIdx...>(thread_safety);
-		auto const mod_val				= (... | mod_val_for_each_bit(BitIdx_c<BitIdx>{}, t_param));
-		constexpr auto clear_mask = ~(... | GET_BIT<BitIdx>().mask);
+		using AccessType = decltype(mmio_load(readReg<BitIdx...>(thread_safety)));
 
-		readCurrentVal<BitIdx...>(thread_safety) = ((current_val & clear_mask) | mod_val);
+		auto const current_val						 = static_cast<std::uint32_t>(readCurrentVal<BitIdx...>(thread_safety));
+		auto const mod_val								 = static_cast<std::uint32_t>((... | mod_val_for_each_bit(BitIdx_c<BitIdx>{}, t_param)));
+		constexpr std::uint32_t clear_mask = ~(... | GET_BIT<BitIdx>().mask);
+
+		readReg<BitIdx...>(thread_safety) = static_cast<AccessType>((current_val & clear_mask) | mod_val);
 	}
 
 	/**
@@ -438,9 +540,9 @@ class Register {
 	}
 
 	/**
-	 * @brief 	This function set the bit in atomic way
-	 * @note 		This should check whether it is doable or not, according to bit banding address,
-	 * 					not implemented yet
+	 * @brief 	This function set the bit in atomic way, see @ref atomicWriteMasked
+	 * @note 		Register with atomicity enabled is always written in atomic way, this overload is kept so that the intent
+	 * 					can be expressed explicitly.
 	 */
 	template <BitListIdx BitIdx, typename ValueType, bool b>
 	constexpr void writeBit(ValueType const t_param, Atomic_t<b> const& /*unused*/) const noexcept;
@@ -469,7 +571,7 @@ class Register {
 	[[nodiscard]] constexpr auto readBit(ValueOnlyType /*unused*/) const noexcept {
 		static_assert((GET_BIT<BitIdx>().isReadable() && ...));
 
-		auto const reg_val = readReg<BitIdx...>();
+		auto const reg_val = mmio_load(readReg<BitIdx...>());
 		return std::tuple{extractBitValue<BitIdx>(reg_val)...};
 	}
 
@@ -481,7 +583,7 @@ class Register {
 	constexpr void clearBit() const noexcept {
 		static_assert((!(GET_BIT<BitIdx>().MOD == BitMod::RdClrWr1) && ...));
 
-		readReg<BitIdx...>() &= ~(GET_BIT<BitIdx>().mask | ...);
+		writeMasked<BitIdx...>(0U);
 	}
 
 	/**
@@ -489,6 +591,11 @@ class Register {
 	 */
 	constexpr void reset() const noexcept { MMIO32(m_base, m_offset) = m_resetVal; }
 
+	/**
+	 * @brief 	This function returns the reset value of the register
+	 */
+	[[nodiscard]] constexpr auto resetVal() const noexcept { return m_resetVal; }
+
 	/**
 	 * [memoryAddr description]
 	 * @return [description]
@@ -506,11 +613,373 @@ class Register {
 	 * @return  The memory address of register
 	 */
 	[[nodiscard]] constexpr auto memoryAddr() const noexcept { return m_base + m_offset; }
+
+	/**
+	 * @brief		This function returns the mask of bits and the value of register when the bits equal t_param, i.e.
+	 * 					(register & mask) == value, used to describe the status to be polled, see @ref init::wait_until
+	 * @tparam	BitIdx	Bits to be compared
+	 * @param 	t_param Expected value of the bits, all bits are expected to be set if nothing is given (single bit only)
+	 * @return 	std::pair of mask and value
+	 */
+	template <BitListIdx... BitIdx, typename... ValueTypes>
+	[[nodiscard]] static constexpr auto condition(ValueTypes const... t_param) noexcept {
+		static_assert((GET_BIT<BitIdx>().isReadable() && ...));
+		constexpr std::uint32_t mask = (GET_BIT<BitIdx>().mask | ...);
+
+		if constexpr (sizeof...(ValueTypes) == 0) {
+			static_assert(((GET_BIT<BitIdx>().LENGTH == 1) && ...));
+			return std::pair{mask, mask};
+		} else {
+			static_assert(sizeof...(BitIdx) == sizeof...(ValueTypes));
+			static_assert((GET_BIT<BitIdx>().template isTypeAvailable<ValueTypes>() && ...));
+			return std::pair{mask, static_cast<std::uint32_t>((... | GET_BIT<BitIdx>()(t_param)))};
+		}
+	}
+
+	/**
+	 * @class 	BasicModification
+	 * @brief		This class collects field updates of the register, the fields to be modified are recorded in the
+	 * 					template parameter list, so that the mask to clear and the necessity of reading the register are known
+	 * 					at compile time. Nothing is written to the register until @ref apply is called, at which point the
+	 * 					register is read at most once, and written exactly once.
+	 * @tparam	Reg			Register to be modified, i.e. @ref Register or @ref CachedRegister
+	 * @tparam	ModIdx	Bits that are modified so far
+	 *
+	 * @note 		If the same bit is modified more than once, the last modification wins.
+	 */
+	template <typename Reg, BitListIdx... ModIdx>
+	class BasicModification {
+	 private:
+		friend class Register;
+
+		template <typename, typename, Access, typename, typename, typename>
+		friend class CachedRegister;
+
+		Reg const& m_reg;							/*!< Register to be modified */
+		std::uint32_t const m_modVal; /*!< Value of modified bits */
+
+		constexpr BasicModification(Reg const& t_reg, std::uint32_t const t_mod_val) noexcept
+			: m_reg(t_reg), m_modVal(t_mod_val) {}
+
+		/**
+		 * @brief		This function merges new modification into current one
+		 * @tparam	BitIdx	Bits to be modified
+		 * @param 	t_val 	Value of the bits, already shifted to the right position
+		 * @return 	New Modification
+		 */
+		template <BitListIdx... BitIdx>
+		[[nodiscard]] constexpr auto merge(std::uint32_t const t_val) const noexcept {
+			constexpr std::uint32_t mask = (GET_BIT<BitIdx>().mask | ...);
+			return BasicModification<Reg, ModIdx..., BitIdx...>{m_reg, (m_modVal & ~mask) | (t_val & mask)};
+		}
+
+	 public:
+		/**
+		 * @brief		This function records single bit set to 1, see @ref Register::setBit
+		 * @tparam	BitIdx	The bit to be set in the register
+		 */
+		template <BitListIdx... BitIdx>
+		[[nodiscard]] constexpr auto setBit() const noexcept {
+			static_assert(((GET_BIT<BitIdx>().LENGTH == 1) && ...));
+
+			return merge<BitIdx...>((GET_BIT<BitIdx>().mask | ...));
+		}
+
+		/**
+		 * @brief		This function records bits cleared to 0, see @ref Register::clearBit
+		 * @tparam 	BitIdx 	Position of the bit
+		 */
+		template <BitListIdx... BitIdx>
+		[[nodiscard]] constexpr auto clearBit() const noexcept {
+			static_assert((!(GET_BIT<BitIdx>().MOD == BitMod::RdClrWr1) && ...));
+
+			return merge<BitIdx...>(0U);
+		}
+
+		/**
+		 * @brief		This function records multiple bits set to same value, see @ref Register::writeBit
+		 * @tparam	BitIdx 		Variadic template parameter that contains the positions of bits.
+		 * @param 	t_param		Value to be written.
+		 */
+		template <BitListIdx... BitIdx, typename ValueType>
+		[[nodiscard]] constexpr auto writeBit(ValueType const t_param) const noexcept {
+			static_assert((GET_BIT<BitIdx>().template isTypeAvailable<ValueType>() && ...));
+			static_assert((GET_BIT<BitIdx>().isWritable() && ...));
+
+			return merge<BitIdx...>(static_cast<std::uint32_t>((... | GET_BIT<BitIdx>()(t_param))));
+		}
+
+		/**
+		 * @brief		This function records multiple bits set to corresponding values, see @ref Register::writeBit
+		 * @tparam	BitIdx			Variadic template parameter that contains the positions of bits.
+		 * @param 	t_param			Input value to be set.
+		 */
+		template <BitListIdx... BitIdx, typename... ValueTypes>
+		[[nodiscard]] constexpr auto writeBit(ValueTypes const... t_param) const noexcept {
+			static_assert(sizeof...(BitIdx) == sizeof...(ValueTypes));
+			static_assert((GET_BIT<BitIdx>().template isTypeAvailable<ValueTypes>() && ...));
+			static_assert((GET_BIT<BitIdx>().isWritable() && ...));
+
+			return merge<BitIdx...>(static_cast<std::uint32_t>((... | GET_BIT<BitIdx>()(t_param))));
+		}
+
+		/**
+		 * @brief		This function returns the store done by @ref apply as plain data, i.e. address, mask of bits to be kept
+		 * 					(0 if the register needn't be read) and value of modified bits, see @ref init::write
+		 * @return 	std::tuple of address, keep mask and value
+		 */
+		[[nodiscard]] constexpr auto storeInfo() const noexcept {
+			// CachedRegister must be written through its shadow, a raw store leaves the shadow stale
+			static_assert(std::is_same_v<Reg, Register>);
+			static_assert(sizeof...(ModIdx) != 0);
+
+			constexpr std::uint32_t keep_mask = isReadNeeded<ModIdx...>() ? ~(GET_BIT<ModIdx>().mask | ...) : 0U;
+			return std::tuple{m_reg.memoryAddr(), keep_mask, m_modVal};
+		}
+
+		/**
+		 * @brief 	This function writes all recorded modifications to the register in a single store
+		 */
+		constexpr void apply() const noexcept {
+			static_assert(sizeof...(ModIdx) != 0);
+
+			m_reg.template writeMasked<ModIdx...>(m_modVal);
+		}
+	};
+
+	template <BitListIdx... ModIdx>
+	using Modification = BasicModification<Register, ModIdx...>;
+
+	/**
+	 * @brief		This function starts a modification of the register, see @ref Modification
+	 * @return	Empty modification
+	 *
+	 * @code{.cpp}
+	 * 	reg::CR1<SPI>.modify().template setBit<CR1Field::MSTR>().template writeBit<CR1Field::BR>(baud).apply();
+	 * @endcode
+	 */
+	[[nodiscard]] constexpr auto modify() const noexcept { return Modification<>{*this, 0U}; }
 };	// namespace cpp_stm32
 
 template <typename BitList, typename BitIdx, Access IoOp>
 using AtomicReg = Register<BitList, BitIdx, IoOp, true>;
 
+/**
+ * @class 	CachedRegister
+ * @brief		This class is abstraction of configuration register that keeps a copy of register value in RAM (shadow).
+ * 					Read-modify-write is served from the shadow, and written through to the register, i.e. the register is
+ * 					only written, not read, unless the modification can't be done without knowing hardware state.
+ * @tparam  BitList			List of bit in the register, see @ref Bit
+ * @tparam	BitListIdx	The way to index through the list of bit, this should be a scoped enum.
+ * @tparam	Access			Access flag indicating which MMIO operation is suitable to read/write
+ * @tparam	HwMod				Read/write bits that are modified by hardware as well, see @ref HwModified
+ * @tparam	SelfClr			Read/write bits that are cleared by hardware, see @ref SelfClearing
+ *
+ * @note 		Only read/write bits that are in neither HwMod nor SelfClr are cached, the rest are decided by @ref BitMod:
+ * 					 - read only, read/set and read/clear-by-writing-1 bits are written as 0, which has no effect
+ * 					 - write only bits and bits in SelfClr are written as 0 unless they are the bits to be written, i.e.
+ * 					 	 the register must not be written while the triggered operation is still ongoing
+ * 					 - read/write bits in HwMod are read from register unless they are the bits to be written
+ *
+ * @note 		The shadow is a mutable member, declare the register as inline (instead of static) so that every
+ * 					translation unit shares the same shadow, e.g.
+ *
+ * @code{.cpp}
+ * 	template <Port DMA, Stream Str>
+ * 	inline constexpr CachedRegister<SxCRBitList, SxCRField, DEFAULT_ACCESS, HwModified<SxCRField::EN>> SxCR{...};
+ * @endcode
+ *
+ * @note 		The shadow assumes that the register is only modified via this class, call @ref sync if the register is
+ * 					modified otherwise, e.g. peripheral reset via RCC.
+ */
+template <typename BitList, typename BitListIdx, Access IoOp, BitListIdx... HwIdx, BitListIdx... SelfClrIdx,
+					typename IdxPolicy>
+class CachedRegister<BitList, BitListIdx, IoOp, HwModified<HwIdx...>, SelfClearing<SelfClrIdx...>, IdxPolicy> {
+ private:
+	using Reg = Register<BitList, BitListIdx, IoOp, false, IdxPolicy>;
+
+	template <typename, BitListIdx...>
+	friend class Reg::BasicModification;
+
+	template <BitListIdx Idx>
+	static constexpr auto GET_BIT = Reg::template GET_BIT<Idx>;
+
+	/**
+	 * @brief		This function calculates the mask of bits that are served from the shadow
+	 */
+	template <std::size_t... Idx>
+	static constexpr auto calcCachedMask(std::index_sequence<Idx...> const /*unused*/) noexcept {
+		constexpr auto cached_mask_of = [](auto const t_bit) {
+			return decltype(t_bit)::MOD == BitMod::RdWr ? t_bit.mask : 0U;
+		};
+
+		return (0U | ... | cached_mask_of(get_bit<BitList, Idx>())) & ~(0U | ... | GET_BIT<HwIdx>().mask) &
+					 ~(0U | ... | GET_BIT<SelfClrIdx>().mask);
+	}
+
+	static constexpr std::uint32_t CACHED_MASK = calcCachedMask(std::make_index_sequence<BitList::LIST_SIZE>{});
+	static constexpr std::uint32_t HW_MOD_MASK = (0U | ... | GET_BIT<HwIdx>().mask);
+
+	Reg const m_reg;								 /*!< Register to be written through */
+	mutable std::uint32_t m_shadow; /*!< Cached bits of the register */
+
+	/**
+	 * @brief		This function writes bits with value that is already shifted to the right position, the register is read
+	 * 					only if there is bit modified by hardware that is not to be written.
+	 * @tparam	BitIdx	Bits to be written
+	 * @param 	t_val 	Value of the bits
+	 */
+	template <BitListIdx... BitIdx>
+	constexpr void writeMasked(std::uint32_t const t_val) const noexcept {
+		constexpr std::uint32_t mod_mask = (GET_BIT<BitIdx>().mask | ...);
+		constexpr std::uint32_t hw_mask	 = HW_MOD_MASK & ~mod_mask;
+
+		auto const hw_val = [this]() -> std::uint32_t {
+			if constexpr (hw_mask != 0U) {
+				return mmio_load(m_reg.template readReg<>()) & hw_mask;
+			} else {
+				return 0U;
+			}
+		}();
+
+		m_shadow = (m_shadow & ~mod_mask) | (t_val & mod_mask & CACHED_MASK);
+		m_reg.template readReg<>() = (m_shadow | hw_val | (t_val & mod_mask & ~CACHED_MASK));
+	}
+
+ public:
+	/**
+	 * @brief		Construct CachedRegister by base peripheral address and offset, the shadow is initialized to reset value
+	 * @param   base   	Base peripheral address
+	 * @param   offset 	Offset address
+	 */
+	explicit constexpr CachedRegister(std::uint32_t const base, std::uint32_t const offset,
+																		ResetVal_t const& t_rst = ResetVal_t{0x0})
+		: m_reg(base, offset, t_rst), m_shadow(t_rst.get() & CACHED_MASK) {}
+
+	/**
+	 * @brief 	This function set single bit to 1, see @ref Register::setBit
+	 * @tparam	BitIdx	The bit to be set in the register
+	 */
+	template <BitListIdx... BitIdx>
+	constexpr void setBit() const noexcept {
+		static_assert(((GET_BIT<BitIdx>().LENGTH == 1) && ...));
+
+		writeMasked<BitIdx...>((GET_BIT<BitIdx>().mask | ...));
+	}
+
+	/**
+	 * @brief		This function writes 0 to the register at bit at BitIdx, see @ref Register::clearBit
+	 * @tparam 	BitIdx 	Position of the bit
+	 */
+	template <BitListIdx... BitIdx>
+	constexpr void clearBit() const noexcept {
+		static_assert((!(GET_BIT<BitIdx>().MOD == BitMod::RdClrWr1) && ...));
+
+		writeMasked<BitIdx...>(0U);
+	}
+
+	/**
+	 * @brief		This function set multiple bits to same value, see @ref Register::writeBit
+	 * @tparam	BitIdx 		Variadic template parameter that contains the positions of bits.
+	 * @param 	t_param		Value to be written.
+	 */
+	template <BitListIdx... BitIdx, typename ValueType>
+	constexpr void writeBit(ValueType const t_param) const noexcept {
+		static_assert((GET_BIT<BitIdx>().template isTypeAvailable<ValueType>() && ...));
+		static_assert((GET_BIT<BitIdx>().isWritable() && ...));
+
+		writeMasked<BitIdx...>(static_cast<std::uint32_t>((... | GET_BIT<BitIdx>()(t_param))));
+	}
+
+	/**
+	 * @brief		This function set multiple bits to corresponding values, see @ref Register::writeBit
+	 * @tparam	BitIdx			Variadic template parameter that contains the positions of bits.
+	 * @param 	t_param 		Bits value wrapped in std::tuple
+	 */
+	template <BitListIdx... BitIdx, typename... ValueTypes>
+	constexpr void writeBit(std::tuple<ValueTypes...> const& t_param) const noexcept {
+		std::apply([this](auto const... t_val) { writeBit<BitIdx...>(t_val...); }, t_param);
+	}
+
+	/**
+	 * @brief		This function set multiple bits to corresponding values, see @ref Register::writeBit
+	 * @tparam	ValueTypes	Variadic template parameter that contains the type to be set to for each bit in BitIdx.
+	 * @param 	t_param			Input value to be set.
+	 */
+	template <BitListIdx... BitIdx, typename... ValueTypes>
+	constexpr void writeBit(ValueTypes const... t_param) const noexcept {
+		static_assert(sizeof...(BitIdx) == sizeof...(ValueTypes));
+		static_assert((GET_BIT<BitIdx>().template isTypeAvailable<ValueTypes>() && ...));
+		static_assert((GET_BIT<BitIdx>().isWritable() && ...));
+
+		writeMasked<BitIdx...>(static_cast<std::uint32_t>((... | GET_BIT<BitIdx>()(t_param))));
+	}
+
+	/**
+	 * @brief		This function reads bits and return std::tuple, bits that are cached are read from the shadow
+	 * @param  	ValueOnlyType  	Overload tag, see @ref ValueOnlyType
+	 * @return 	Bits value wrapped in Tuple, @see detail::Tuple
+	 */
+	template <BitListIdx... BitIdx>
+	[[nodiscard]] constexpr auto readBit(ValueOnlyType /*unused*/) const noexcept {
+		static_assert((GET_BIT<BitIdx>().isReadable() && ...));
+
+		if constexpr (((GET_BIT<BitIdx>().mask & ~CACHED_MASK) | ...) == 0U) {
+			return std::tuple{m_reg.template extractBitValue<BitIdx>(m_shadow)...};
+		} else {
+			return m_reg.template readBit<BitIdx...>(ValueOnly);
+		}
+	}
+
+	/**
+	 * @brief		This function starts a modification of the register, see @ref Register::BasicModification
+	 * @return	Empty modification
+	 */
+	[[nodiscard]] constexpr auto modify() const noexcept {
+		return typename Reg::template BasicModification<CachedRegister>{*this, 0U};
+	}
+
+	/**
+	 * @brief 	This function reads the register to the shadow
+	 */
+	constexpr void sync() const noexcept { m_shadow = mmio_load(m_reg.template readReg<>()) & CACHED_MASK; }
+
+	/**
+	 * @brief 	This function reset the register and the shadow to reset value
+	 */
+	constexpr void reset() const noexcept {
+		m_reg.reset();
+		m_shadow = m_reg.m_resetVal & CACHED_MASK;
+	}
+
+	/**
+	 * @brief		This function returns the reset value of the bit, see @ref Register::defaultVal
+	 */
+	template <BitListIdx BitIdx>
+	[[nodiscard]] constexpr auto defaultVal() const noexcept {
+		return m_reg.template defaultVal<BitIdx>();
+	}
+
+	/**
+	 * @brief 	This function returns the memory address of the register
+	 * @return  The memory address of register
+	 */
+	[[nodiscard]] constexpr auto memoryAddr() const noexcept { return m_reg.memoryAddr(); }
+};
+
+/**
+ * @brief		This function applies modifications of multiple registers, each register is read at most once and
+ * 					written exactly once, in the order of the input.
+ * @param 	t_mods 	Modifications, see @ref Register::Modification
+ *
+ * @note 		Modifications of the same register should be chained instead of passing separately, otherwise the
+ * 					register will be written multiple times.
+ */
+template <typename... Modifications>
+constexpr void apply(Modifications const&... t_mods) noexcept {
+	(t_mods.apply(), ...);
+}
+
 /**
  * @def 		SETUP_REGISTER_INFO(Name, ...)
  * @brief		A helper macro to instantiate class (bit list) with class name @arg Name, and bits.
@@ -20,6 +20,7 @@
 
 #include "cpp_stm32/hal/mmio.hxx"
 #include "cpp_stm32/hal/register.hxx"
+#include "cpp_stm32/processor/cortex_m4/core_util.hxx"
 #include "cpp_stm32/utility/utility.hxx"
 
 namespace cpp_stm32 {
@@ -31,6 +32,8 @@ enum class BitBandAddr : std::uint32_t {
 	AliasPeriphBase = 0x4200'0000U
 };
 
+static constexpr auto BIT_BAND_REGION_SIZE = 0x10'0000U;
+
 constexpr auto to_alias_periph_addr(std::uint32_t const& t_mem_addr, std::uint8_t const& t_bit) noexcept {
 	return to_underlying(BitBandAddr::AliasPeriphBase) + (t_mem_addr - to_underlying(BitBandAddr::PeriphBase)) * 32U +
 				 t_bit * 4U;
@@ -43,12 +46,12 @@ constexpr auto to_alias_sram_addr(std::uint32_t const& t_mem_addr, std::uint8_t
 
 constexpr auto is_in_sram_bit_band_region(std::uint32_t const& t_mem_addr) noexcept {
 	return to_underlying(BitBandAddr::SRAMBase) <= t_mem_addr &&
-				 t_mem_addr <= to_underlying(BitBandAddr::AliasPeriphBase);
+				 t_mem_addr < to_underlying(BitBandAddr::SRAMBase) + BIT_BAND_REGION_SIZE;
 }
 
 constexpr auto is_in_periph_bit_band_region(std::uint32_t const& t_mem_addr) noexcept {
 	return to_underlying(BitBandAddr::PeriphBase) <= t_mem_addr &&
-				 t_mem_addr <= to_underlying(BitBandAddr::AliasPeriphBase);
+				 t_mem_addr < to_underlying(BitBandAddr::PeriphBase) + BIT_BAND_REGION_SIZE;
 }
 
 constexpr auto to_alias_addr(std::uint32_t const& t_mem_addr, std::uint8_t const& t_bit) noexcept {
@@ -57,7 +60,7 @@ constexpr auto to_alias_addr(std::uint32_t const& t_mem_addr, std::uint8_t const
 	} else if (is_in_sram_bit_band_region(t_mem_addr)) {
 		return to_alias_sram_addr(t_mem_addr, t_bit);
 	} else {
-		return 0UL;
+		return 0U;
 	}
 }
 
@@ -65,6 +68,49 @@ constexpr auto atomicity(std::uint32_t const& t_mem_addr) noexcept {
 	return is_in_periph_bit_band_region(t_mem_addr) || is_in_sram_bit_band_region(t_mem_addr);
 }
 
+/**
+ * @brief		This function does read-modify-write of a word by exclusive access, the modification is retried if the word
+ * 					is accessed by others (e.g. ISR) in between.
+ * @param 	t_mem_addr 	Address of the word
+ * @param 	t_modifier 	Function that takes current value and returns new value
+ *
+ * @note 		Exclusive access is only meaningful on target, other MMIO backend (e.g. @ref HostMmio) does plain
+ * 					read-modify-write.
+ */
+template <typename Modifier>
+constexpr void exclusive_modify(std::uint32_t const t_mem_addr, Modifier const& t_modifier) noexcept {
+	if constexpr (std::is_same_v<MmioBackend, TargetMmio>) {
+		auto* const addr = reinterpret_cast<std::uint32_t volatile*>(t_mem_addr);
+
+		while (core::store_exclusive(addr, t_modifier(core::load_exclusive(addr))) != 0U) {
+		}
+	} else {
+		MMIO32(t_mem_addr, 0) = t_modifier(mmio_load(MMIO32(t_mem_addr, 0)));
+	}
+}
+
+/**
+ * @note 		Bit banding alias write is a read-modify-write done by the bus matrix, it is not used if the register
+ * 					contains bits that are cleared by writing 1, otherwise those bits would be cleared as well.
+ */
+template <typename BitList, typename BitListIdx, Access IoOp, bool atomicity, typename IdxPolicy>
+template <BitListIdx... BitIdx>
+constexpr void Register<BitList, BitListIdx, IoOp, atomicity, IdxPolicy>::atomicWriteMasked(
+	std::uint32_t const t_val) const noexcept {
+	constexpr bool single_bit = sizeof...(BitIdx) == 1 && ((GET_BIT<BitIdx>().LENGTH == 1) && ...);
+	constexpr bool clr_by_wr1 = maskOfBitMod<BitMod::RdClrWr1>(std::make_index_sequence<BitList::LIST_SIZE>{}) != 0U;
+
+	if constexpr (!isReadNeeded<BitIdx...>()) {
+		readReg<BitIdx...>() = t_val;
+	} else if constexpr (single_bit && !clr_by_wr1) {
+		constexpr auto pos = (GET_BIT<BitIdx>().pos + ...);
+		MMIO32(to_alias_addr(m_base + m_offset, pos), 0) = (t_val >> pos) & 1U;
+	} else {
+		constexpr std::uint32_t clear_mask = ~(GET_BIT<BitIdx>().mask | ...);
+		exclusive_modify(m_base + m_offset, [t_val](auto const t_reg_val) { return (t_reg_val & clear_mask) | t_val; });
+	}
+}
+
 template <typename BitList, typename BitListIdx, Access IoOp, bool atomicity, typename IdxPolicy>
 template <BitListIdx BitIdx, typename ValueType, bool b>
 constexpr void Register<BitList, BitListIdx, IoOp, atomicity, IdxPolicy>::writeBit(
@@ -74,19 +120,7 @@ constexpr void Register<BitList, BitListIdx, IoOp, atomicity, IdxPolicy>::writeB
 	static_assert((bit.template isTypeAvailable<ValueType>()));
 	static_assert((bit.isWritable()));
 
-	auto const val = [=]() {
-		if constexpr (std::is_enum_v<ValueType>) {
-			return to_underlying(t_param);
-		} else if constexpr (std::is_integral_v<ValueType>) {
-			return t_param;
-		} else {
-			return t_param.get();
-		}
-	}();
-
-	for (std::uint8_t i = 0U; i < bit.LENGTH; ++i) {
-		MMIO32(m_base + m_offset, i) = (val & (1U << i)) >> i;
-	}
+	atomicWriteMasked<BitIdx>(static_cast<std::uint32_t>(bit(t_param)));
 }
 
 }	 // namespace cpp_stm32
@@ -137,6 +137,33 @@ namespace cpp_stm32::core {
 	return ret_val;
 }
 
+/**
+ * @brief 	This function loads word from memory and tags the address for exclusive access
+ * @param 	t_addr 	Address to load
+ * @return 	Value at the address
+ */
+[[gnu::always_inline, nodiscard]] inline auto load_exclusive(std::uint32_t volatile* const t_addr) noexcept {
+	std::uint32_t ret_val;
+	__asm volatile("ldrex %0, [%1]" : "=r"(ret_val) : "r"(t_addr) : "memory");
+
+	return ret_val;
+}
+
+/**
+ * @brief 	This function stores word to memory if the address is still tagged for exclusive access, i.e. no
+ * 					exception or other exclusive access since @ref load_exclusive
+ * @param 	t_addr 	Address to store
+ * @param 	t_val 	Value to store
+ * @return 	0 if the store succeeded, 1 otherwise
+ */
+[[gnu::always_inline, nodiscard]] inline auto store_exclusive(std::uint32_t volatile* const t_addr,
+																															std::uint32_t const t_val) noexcept {
+	std::uint32_t ret_val;
+	__asm volatile("strex %0, %2, [%1]" : "=&r"(ret_val) : "r"(t_addr), "r"(t_val) : "memory");
+
+	return ret_val;
+}
+
 }	 // namespace cpp_stm32::core
 
 namespace cpp_stm32::core {
@@ -0,0 +1,45 @@
+/**
+ * @file  processor/cortex_m4/dwt.hxx
+ * @brief	Cycle counter of Data Watchpoint and Trace unit
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "cpp_stm32/processor/cortex_m4/register/dwt.hxx"
+
+namespace cpp_stm32::dwt {
+
+/**
+ * @brief		This function starts the cycle counter, which counts core clock cycle and wraps around at 2^32
+ */
+constexpr void enable_cycle_counter() noexcept {
+	reg::DEMCR.setBit<reg::DEMCRField::TRCENA>();
+	reg::CYCCNT.writeBit<reg::CYCCNTField::CYCCNT>(std::uint32_t{0});
+	reg::CTRL.setBit<reg::CTRLField::CYCCNTENA>();
+}
+
+/**
+ * @brief		This function returns current cycle count, elapsed cycle is the difference of two counts (modulo 2^32)
+ */
+[[nodiscard]] constexpr std::uint32_t get_cycle_count() noexcept {
+	return std::get<0>(reg::CYCCNT.readBit<reg::CYCCNTField::CYCCNT>(ValueOnly));
+}
+
+}	// namespace cpp_stm32::dwt
@@ -0,0 +1,81 @@
+/**
+ * @file  processor/cortex_m4/register/dwt.hxx
+ * @brief	Data Watchpoint and Trace register
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "cpp_stm32/hal/bit.hxx"
+#include "cpp_stm32/hal/register.hxx"
+
+namespace cpp_stm32::dwt::reg {
+
+static constexpr auto DWT_BASE	 = 0xE0001000U;
+static constexpr auto DEBUG_BASE = 0xE000EDF0U;
+
+/**
+ * @defgroup 	DEMCR_GROUP 	Debug Exception and Monitor Control Register group
+ *
+ * @{
+ */
+SETUP_REGISTER_INFO(DEMCRBitList, /**/
+										Binary<>{BitPos_t{24}}	// TRCENA
+)
+
+enum class DEMCRField {
+	TRCENA, /*!< Global enable for DWT and ITM */
+};
+
+static constexpr Register<DEMCRBitList, DEMCRField> DEMCR{DEBUG_BASE, 0x0CU};
+
+/**@}*/
+
+/**
+ * @defgroup 	DWT_CTRL_GROUP 	DWT Control Register group
+ *
+ * @{
+ */
+SETUP_REGISTER_INFO(CTRLBitList, /**/
+										Binary<>{BitPos_t{0}}	// CYCCNTENA
+)
+
+enum class CTRLField {
+	CYCCNTENA, /*!< Enable cycle counter */
+};
+
+static constexpr Register<CTRLBitList, CTRLField> CTRL{DWT_BASE, 0x00U};
+
+/**@}*/
+
+/**
+ * @defgroup 	DWT_CYCCNT_GROUP 	DWT Cycle Count Register group
+ *
+ * @{
+ */
+SETUP_REGISTER_INFO(CYCCNTBitList, /**/
+										Bit<32, std::uint32_t>{BitPos_t{0}})
+
+enum class CYCCNTField { CYCCNT };
+
+static constexpr Register<CYCCNTBitList, CYCCNTField> CYCCNT{DWT_BASE, 0x04U};
+
+/**@}*/
+
+}	// namespace cpp_stm32::dwt::reg
@@ -0,0 +1,241 @@
+/**
+ * @file  stm32/f4/crc.hxx
+ * @brief	CRC calculation unit of stm32f4
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+#include "cpp_stm32/hal/callback.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+#include "cpp_stm32/target/stm32/f4/dma.hxx"
+#include "cpp_stm32/target/stm32/f4/nvic.hxx"
+#include "cpp_stm32/target/stm32/f4/pin_map/dma.hxx"
+#include "cpp_stm32/target/stm32/f4/register/crc.hxx"
+
+/**
+ * The CRC unit computes CRC-32/MPEG-2 (polynomial 0x04C11DB7, initial value 0xFFFFFFFF, no reflection, no final xor) of
+ * 32 bit words, MSB of each word first. Software equivalent is SlicedCrc<Crc32Mpeg2>::compute(words), see
+ * utility/crc.hxx. The CRC clock (rcc::PeriphClk::Crc) must be enabled.
+ */
+namespace cpp_stm32::crc {
+
+/**
+ * @brief		This function resets the unit to initial value 0xFFFFFFFF
+ */
+constexpr void reset() noexcept { reg::CR.setBit<reg::CRField::RESET>(); }
+
+/**
+ * @brief		This function shifts one word into the unit, the unit takes 4 AHB clock cycles per word, during which the bus
+ * 					is stalled, i.e. back to back write doesn't need any waiting
+ */
+constexpr void feed(std::uint32_t const t_word) noexcept { reg::DR.writeBit<reg::DRField::DR>(t_word); }
+
+/**
+ * @brief		This function returns the CRC of the words fed since last reset
+ */
+[[nodiscard]] constexpr std::uint32_t value() noexcept {
+	return std::get<0>(reg::DR.readBit<reg::DRField::DR>(ValueOnly));
+}
+
+/**
+ * @brief		This function computes CRC of words by CPU
+ */
+constexpr std::uint32_t compute(Span<std::uint32_t const> const t_words) noexcept {
+	reset();
+
+	for (auto const word : t_words) {
+		feed(word);
+	}
+
+	return value();
+}
+
+/**
+ * @brief		Number of word below which @ref CrcDma feeds the unit by CPU, setting up the stream costs about as much as
+ * 					feeding the words directly
+ */
+static constexpr std::size_t CRC_DMA_CPU_THRESHOLD = 64;
+
+using CrcCallback = void (*)(std::uint32_t) noexcept;
+
+/**
+ * @class 	CrcDma
+ * @brief		Feeds the unit by DMA2 memory to memory transfer, CPU is free while the unit computes. Buffer longer than
+ * 					65535 words is split into segments, each of which is started when the previous one completes.
+ * @tparam	Str 					@ref dma::Stream of DMA2
+ * @tparam	CpuThreshold 	See @ref CRC_DMA_CPU_THRESHOLD
+ *
+ * @code{.cpp}
+ * 	auto& crc_dma = crc::CrcDma<dma::Stream::Stream1>::instance();
+ * 	crc_dma.start(Span{image});
+ * 	// ... do something else
+ * 	auto const checksum = crc_dma.result();		// waits if not finished yet
+ * @endcode
+ *
+ * @note 		The unit is shared, don't use @ref compute while the transfer is ongoing. DMA2 clock must be enabled.
+ */
+template <dma::Stream Str, std::size_t CpuThreshold = CRC_DMA_CPU_THRESHOLD>
+class CrcDma {
+ private:
+	static constexpr auto DMA					 = dma::Port::DMA2;
+	static constexpr auto IRQ_NUM			 = dma::IrqMap::template getIrqNum<DMA, Str>();
+	static constexpr auto DR_ADDR			 = reg::DR.memoryAddr();
+	static constexpr auto MAX_ITEM_NUM = std::size_t{0xFFFFU};
+
+	std::uint32_t const* m_src{nullptr};
+	std::size_t m_remain{0}; /*!< Number of word that is not started yet */
+	CrcCallback m_onComplete{nullptr};
+	std::atomic<bool> m_busy{false};
+	std::atomic<bool> m_error{false};
+
+	constexpr CrcDma() noexcept = default;
+
+	void startSegment() noexcept {
+		auto const item_num = std::min(m_remain, MAX_ITEM_NUM);
+
+		// the word is read from source by "peripheral" port, and written to the fixed data register by memory port
+		auto builder = dma::DmaBuilder<DMA, Str>{}
+										 .transferDir(dma::MemoryAddress_t{reinterpret_cast<std::uintptr_t>(m_src)},
+																	dma::MemoryAddress_t{DR_ADDR})
+										 .txDataNum(static_cast<std::uint16_t>(item_num))
+										 .enablePeriphIncrement(true)
+										 .perihperalDataWidth(dma::DataSize::Word)
+										 .memoryDataWidth(dma::DataSize::Word)
+										 .configFIFO(dma::FifoThreshold::Half, dma::PeriphBurstSize_t{dma::BurstSize::Single},
+																 dma::MemoryBurstSize_t{dma::BurstSize::Single});
+
+		m_src += item_num;
+		m_remain -= item_num;
+
+		if (m_onComplete != nullptr) {
+			builder.template enableInterrupt<dma::InterruptFlag::TCI, dma::InterruptFlag::TEI>().build();
+		} else {
+			builder.build();
+		}
+	}
+
+	void advance() noexcept {
+		using dma::InterruptFlag;
+
+		auto const [tc_flag, te_flag] = dma::get_interrupt_flag<DMA, Str, InterruptFlag::TCI, InterruptFlag::TEI>();
+		if (tc_flag == 0 && te_flag == 0) {
+			return;
+		}
+
+		dma::clear_interrupt_flag<DMA, Str, InterruptFlag::TCI, InterruptFlag::TEI>();
+
+		if (te_flag == 0 && m_remain != 0) {
+			startSegment();
+			return;
+		}
+
+		m_error = te_flag != 0;
+		m_busy	= false;
+
+		if (m_onComplete != nullptr) {
+			m_onComplete(value());
+		}
+	}
+
+	void irqHandler() noexcept { advance(); }
+
+ public:
+	CrcDma(CrcDma const&) = delete;
+	CrcDma& operator=(CrcDma const&) = delete;
+
+	/**
+	 * @brief		This function returns the only handle of the stream
+	 */
+	[[nodiscard]] static CrcDma& instance() noexcept {
+		static CrcDma handle;	 // constant initialized, no guard
+		return handle;
+	}
+
+	/**
+	 * @brief		This function resets the unit and starts feeding the words
+	 * @param 	t_words 	Data, must stay unmodified until finished
+	 * @param 	t_cb 			Called with the result in DMA interrupt when finished, or nullptr to poll @ref done instead
+	 *
+	 * @note 		Below CpuThreshold, t_cb is called before this function returns, in the context of the caller, not in DMA
+	 * 					interrupt.
+	 */
+	void start(Span<std::uint32_t const> const t_words, CrcCallback const t_cb = nullptr) noexcept {
+		wait();
+		reset();
+
+		if (t_words.size() < CpuThreshold) {
+			for (auto const word : t_words) {
+				feed(word);
+			}
+
+			return t_cb != nullptr ? t_cb(value()) : void();
+		}
+
+		m_src				 = t_words.data();
+		m_remain		 = t_words.size();
+		m_onComplete = t_cb;
+		m_error			 = false;
+		m_busy			 = true;
+
+		if (t_cb != nullptr) {
+			nvic::enable_irq<IRQ_NUM>(Callback<&CrcDma::irqHandler>{this});
+		}
+
+		startSegment();
+	}
+
+	/**
+	 * @brief		This function checks whether all words are fed, and starts next segment if no callback is given
+	 */
+	[[nodiscard]] bool done() noexcept {
+		if (m_busy && m_onComplete == nullptr) {
+			advance();
+		}
+
+		return !m_busy;
+	}
+
+	/**
+	 * @brief		This function checks whether the transfer is stopped by transfer error, the result is invalid if so
+	 */
+	[[nodiscard]] bool failed() const noexcept { return m_error; }
+
+	void wait() noexcept {
+		while (!done()) {
+		}
+	}
+
+	/**
+	 * @brief		This function waits until finished, and returns the CRC
+	 */
+	[[nodiscard]] std::uint32_t result() noexcept {
+		wait();
+		return value();
+	}
+};
+
+}	 // namespace cpp_stm32::crc
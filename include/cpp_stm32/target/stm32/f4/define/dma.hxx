@@ -85,6 +85,61 @@ enum class BurstSize : std::uint8_t { Single, Incr4, Incr8, Incr16 };
 enum class FifoThreshold : std::uint8_t { OneFourths, Half, ThreeFourths, Full };
 enum class FlowControl : std::uint8_t { DMA, Peripheral };
 
+/**
+ * @enum 		Request
+ * @brief		DMA request of peripheral, see @ref RequestMap for the stream and channel each of them is routed to
+ */
+enum class Request : std::uint8_t {
+	Adc1,
+	Adc2,
+	Adc3,
+	Dac1,
+	Dac2,
+	I2c1Rx,
+	I2c1Tx,
+	I2c2Rx,
+	I2c2Tx,
+	I2c3Rx,
+	I2c3Tx,
+	Spi1Rx,
+	Spi1Tx,
+	Spi2Rx,
+	Spi2Tx,
+	Spi3Rx,
+	Spi3Tx,
+	Spi4Rx,
+	Spi4Tx,
+	Usart1Rx,
+	Usart1Tx,
+	Usart2Rx,
+	Usart2Tx,
+	Usart3Rx,
+	Usart3Tx,
+	Uart4Rx,
+	Uart4Tx,
+	Uart5Rx,
+	Uart5Tx,
+	Usart6Rx,
+	Usart6Tx,
+	MemToMem, /*!< Memory to memory transfer, any stream of DMA2 */
+};
+
+/**
+ * @enum 		Rate
+ * @brief		Expected data rate of DMA request, high rate requests are spread over DMA1 and DMA2 if possible
+ */
+enum class Rate : std::uint8_t { Low, High };
+
+/**
+ * @struct 	StreamMapping
+ * @brief		Stream and channel a DMA request is routed to
+ */
+struct StreamMapping {
+	Port port{Port::DMA1};
+	Stream stream{Stream::Stream0};
+	Channel channel{Channel::Channel0};
+};
+
 using PeriphBurstSize_t = StrongType<BurstSize, struct PeriphBurstSize>;
 using MemoryBurstSize_t = StrongType<BurstSize, struct MemoryBurstSize>;
 
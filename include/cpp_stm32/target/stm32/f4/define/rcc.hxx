@@ -111,8 +111,13 @@ enum class PeriphClk : std::uint32_t {
 	GpioA,
 	GpioB,
 	GpioC,
-	/*GpioC ~ GpioF*/
+	GpioD,
+	GpioE,
+	GpioF,
+	GpioG,
+	GpioH,
 
+	Crc,
 	Dma1,
 	Dma2,
 	/*APB1*/
@@ -230,6 +230,36 @@ constexpr void double_buffer_set_target(std::uint8_t const t_mem) noexcept {
 	reg::SxCR<DMA, Str>.template writeBit<reg::SxCRField::CT>(t_mem);
 }
 
+/**
+ * @brief 	This function returns current target in double buffer mode, i.e. the memory DMA is accessing
+ * @tparam 	DMA 	@ref dma::Port
+ * @tparam 	Str 	@ref dma::Stream
+ * @return 	0 for M0 and 1 for M1
+ */
+template <Port DMA, Stream Str>
+[[nodiscard]] constexpr auto double_buffer_get_target() noexcept {
+	return std::get<0>(reg::SxCR<DMA, Str>.template readBit<reg::SxCRField::CT>(ValueOnly));
+}
+
+/**
+ * @brief 	This function sets the address of the memory that DMA is not accessing in double buffer mode, which is
+ * 					allowed while the stream is enabled
+ * @tparam 	DMA 	@ref dma::Port
+ * @tparam 	Str 	@ref dma::Stream
+ * @param 	t_mem_addr memory address, @see dma::MemoryAddress_t
+ *
+ * @note 		Writing the address of current target sets TEIF and disables the stream, call this right after transfer
+ * 					complete, long before the idle memory becomes current target again.
+ */
+template <Port DMA, Stream Str>
+constexpr void double_buffer_set_idle_address(MemoryAddress_t const t_mem_addr) noexcept {
+	if (double_buffer_get_target<DMA, Str>() == 0) {
+		reg::SxM1AR<DMA, Str>.template writeBit<reg::SxM1ARField::M1A>(t_mem_addr.get());
+	} else {
+		reg::SxM0AR<DMA, Str>.template writeBit<reg::SxM0ARField::M0A>(t_mem_addr.get());
+	}
+}
+
 /**
  * @brief 	This function sets DMA memory address
  * @tparam 	DMA 	@ref dma::Port
@@ -463,6 +493,11 @@ class DmaBuilder : detail::Builder<DmaBuilder<DMA, Str>> {
 	bool m_doubleBuffer{false};
 	bool m_currentTarget{0};
 
+	bool m_directModeDisable{false};
+	FifoThreshold m_fifoThreshold{FifoThreshold::Half};
+	BurstSize m_periphBurst{BurstSize::Single};
+	BurstSize m_memoryBurst{BurstSize::Single};
+
 	bool m_fifoErrorIrq{false};
 	bool m_directModeErrorIrq{false};
 	bool m_transferErrorIrq{false};
@@ -567,10 +602,10 @@ class DmaBuilder : detail::Builder<DmaBuilder<DMA, Str>> {
 
 	[[nodiscard]] constexpr auto configFIFO(FifoThreshold const t_fts, PeriphBurstSize_t const t_pb,
 																					MemoryBurstSize_t const t_mb) noexcept {
-		using namespace reg;
-
-		SxFCR<DMA, Str>.template writeBit<SxFCRField::FTH, SxFCRField::DMDIS>(t_fts, std::uint8_t{1});
-		SxCR<DMA, Str>.template writeBit<SxCRField::PBURST, SxCRField::MBURST>(t_pb.get(), t_mb.get());
+		m_directModeDisable = true;
+		m_fifoThreshold			= t_fts;
+		m_periphBurst				= t_pb.get();
+		m_memoryBurst				= t_mb.get();
 
 		return *this;
 	}
@@ -590,17 +625,21 @@ class DmaBuilder : detail::Builder<DmaBuilder<DMA, Str>> {
 	constexpr void build() noexcept {
 		using namespace reg;
 
-		SxFCR<DMA, Str>.template writeBit<SxFCRField::FEIE>(std::uint8_t{m_fifoErrorIrq});
+		// every writable field is given, therefore both registers are written without being read first
+		SxFCR<DMA, Str>.template writeBit<SxFCRField::FTH, SxFCRField::DMDIS, SxFCRField::FEIE>(
+			m_fifoThreshold, std::uint8_t{m_directModeDisable}, std::uint8_t{m_fifoErrorIrq});
 
-		SxCR<DMA, Str>.template writeBit<SxCRField::DMEIE, SxCRField::TEIE, SxCRField::HTIE, SxCRField::TCIE,   //
+		SxCR<DMA, Str>.template writeBit<SxCRField::EN, SxCRField::DMEIE, SxCRField::TEIE, SxCRField::HTIE, SxCRField::TCIE,   //
 		                                 SxCRField::PFCTRL, SxCRField::DIR, SxCRField::CIRC, SxCRField::PINC,
 		                                 SxCRField::MINC, SxCRField::PSIZE, SxCRField::MSIZE, SxCRField::PINCOS,
-		                                 SxCRField::PL, SxCRField::DBM, SxCRField::CT, SxCRField::CHSEL
+		                                 SxCRField::PL, SxCRField::DBM, SxCRField::CT, SxCRField::PBURST,
+		                                 SxCRField::MBURST, SxCRField::CHSEL
 																		 >(
-			std::uint8_t{m_directModeErrorIrq}, std::uint8_t{m_transferErrorIrq}, std::uint8_t{m_halfTransferIrq}, std::uint8_t{m_transferCompleteIrq},
+			std::uint8_t{0}, std::uint8_t{m_directModeErrorIrq}, std::uint8_t{m_transferErrorIrq}, std::uint8_t{m_halfTransferIrq}, std::uint8_t{m_transferCompleteIrq},
 		 	m_flowControl, m_transferDir, std::uint8_t{m_circularMode}, std::uint8_t{m_periphIncrementMode},
 		  std::uint8_t{m_memoryIncrementMode}, m_peripheralDataSize, m_memoryDataSize, std::uint8_t{m_periphFixIncr},
-		  m_streamPriority, std::uint8_t{m_doubleBuffer}, std::uint8_t{m_currentTarget}, m_channelSelect
+		  m_streamPriority, std::uint8_t{m_doubleBuffer}, std::uint8_t{m_currentTarget}, m_periphBurst,
+		  m_memoryBurst, m_channelSelect
 		);
 
 		enable<DMA, Str>();
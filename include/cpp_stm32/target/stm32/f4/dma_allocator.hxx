@@ -0,0 +1,175 @@
+/**
+ * @file  stm32/f4/dma_allocator.hxx
+ * @brief	Compile time DMA stream allocation
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "cpp_stm32/target/stm32/f4/define/dma.hxx"
+#include "cpp_stm32/target/stm32/f4/pin_map/dma.hxx"
+#include "cpp_stm32/utility/utility.hxx"
+
+namespace cpp_stm32::dma {
+
+/**
+ * @struct 	Use
+ * @brief		DMA request a driver of the program needs, see @ref StreamAllocator
+ * @tparam	Req 	@ref Request
+ * @tparam	R 		@ref Rate
+ */
+template <Request Req, Rate R = Rate::Low>
+struct Use {
+	static constexpr auto REQUEST = Req;
+	static constexpr auto RATE		= R;
+};
+
+namespace detail {
+
+template <std::size_t N>
+struct AllocationState {
+	std::array<Request, N> request{};
+	std::array<Rate, N> rate{};
+	std::array<StreamMapping, N> current{};
+	std::array<StreamMapping, N> best{};
+	std::size_t bestCost = std::numeric_limits<std::size_t>::max();
+};
+
+/**
+ * @brief		Depth first search over every stream each request can be routed to, cost is the number of high rate request
+ * 					pairs that are arbitrated by the same DMA controller
+ */
+template <std::size_t N>
+constexpr void search_allocation(AllocationState<N>& t_state, std::size_t const t_depth, std::uint16_t const t_used,
+																 std::size_t const t_cost) noexcept {
+	if (t_state.bestCost == 0 || t_cost >= t_state.bestCost) {
+		return;
+	}
+
+	if (t_depth == N) {
+		t_state.best		 = t_state.current;
+		t_state.bestCost = t_cost;
+		return;
+	}
+
+	auto const request = t_state.request[t_depth];
+
+	for (std::size_t idx = 0; idx < RequestMap::getMappingNum(request); ++idx) {
+		auto const mapping = RequestMap::getMapping(request, idx);
+
+		auto const stream_idx = to_underlying(mapping.port) * 8U + to_underlying(mapping.stream);
+		auto const stream_bit = static_cast<std::uint16_t>(1U << stream_idx);
+		if ((t_used & stream_bit) != 0) {
+			continue;
+		}
+
+		std::size_t cost = 0;
+		if (t_state.rate[t_depth] == Rate::High) {
+			for (std::size_t prev = 0; prev < t_depth; ++prev) {
+				auto const is_contended = t_state.rate[prev] == Rate::High && t_state.current[prev].port == mapping.port;
+				cost += static_cast<std::size_t>(is_contended);
+			}
+		}
+
+		t_state.current[t_depth] = mapping;
+		search_allocation(t_state, t_depth + 1, static_cast<std::uint16_t>(t_used | stream_bit), t_cost + cost);
+	}
+}
+
+}	 // namespace detail
+
+/**
+ * @class 	StreamAllocator
+ * @brief		Assigns stream and channel to every DMA request of the program at compile time, so that no two drivers
+ * 					claim the same stream, and high rate requests are spread over the two DMA controllers if possible.
+ * @tparam	Uses 	@ref Use, one for each DMA request
+ *
+ * @code{.cpp}
+ * 	using Dma = dma::StreamAllocator<dma::Use<dma::Request::Usart2Rx>, dma::Use<dma::Request::Spi1Rx, dma::Rate::High>,
+ * 																	 dma::Use<dma::Request::Spi1Tx, dma::Rate::High>, dma::Use<dma::Request::Adc1>>;
+ *
+ * 	constexpr auto USART_RX = Dma::get<dma::Request::Usart2Rx>();
+ * 	DmaRingRx<USART_RX.port, USART_RX.stream, 64> rx;
+ * 	rx.start(PeriphAddress_t{usart::reg::DR<Usart2>.memoryAddr()}, USART_RX.channel);
+ * @endcode
+ *
+ * @note 		Build fails if the requests can't be routed to distinct streams. Streams that are driven by hand, or
+ * 					time-shared between drivers, are not known to allocator.
+ */
+template <typename... Uses>
+class StreamAllocator {
+ private:
+	static constexpr auto REQUEST_NUM = sizeof...(Uses);
+
+	static constexpr auto ALLOCATION = []() {
+		detail::AllocationState<REQUEST_NUM> state{};
+		state.request = {Uses::REQUEST...};
+		state.rate		= {Uses::RATE...};
+
+		detail::search_allocation(state, 0, 0, 0);
+		return state;
+	}();
+
+	static constexpr auto IS_UNIQUE = []() {
+		std::array<Request, REQUEST_NUM> const requests{Uses::REQUEST...};
+		for (std::size_t i = 0; i < REQUEST_NUM; ++i) {
+			for (std::size_t j = i + 1; j < REQUEST_NUM; ++j) {
+				if (requests[i] == requests[j]) {
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}();
+
+	static_assert(0 < REQUEST_NUM && REQUEST_NUM <= 16, "There are 16 streams in total");
+	static_assert(IS_UNIQUE, "Same DMA request is used more than once");
+	static_assert(ALLOCATION.bestCost != std::numeric_limits<std::size_t>::max(),
+								"DMA stream conflict: the requests can't be routed to distinct streams");
+
+ public:
+	/**
+	 * @brief		This function returns the stream and channel allocated to the request
+	 * @tparam	Req 	One of the requests in Uses
+	 */
+	template <Request Req>
+	[[nodiscard]] static constexpr StreamMapping get() noexcept {
+		static_assert(((Uses::REQUEST == Req) || ...), "Request is not allocated");
+
+		std::size_t idx = 0;
+		while (ALLOCATION.request[idx] != Req) {
+			++idx;
+		}
+
+		return ALLOCATION.best[idx];
+	}
+
+	/**
+	 * @brief		This function returns number of high rate request pair that share the same DMA controller
+	 */
+	[[nodiscard]] static constexpr auto contention() noexcept { return ALLOCATION.bestCost; }
+};
+
+}	 // namespace cpp_stm32::dma
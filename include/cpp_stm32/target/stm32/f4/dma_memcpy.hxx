@@ -0,0 +1,278 @@
+/**
+ * @file  stm32/f4/dma_memcpy.hxx
+ * @brief	Memory to memory copy and fill by DMA2
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "cpp_stm32/hal/callback.hxx"
+#include "cpp_stm32/target/stm32/f4/dma.hxx"
+#include "cpp_stm32/target/stm32/f4/nvic.hxx"
+#include "cpp_stm32/target/stm32/f4/pin_map/dma.hxx"
+
+namespace cpp_stm32::dma {
+
+/**
+ * @brief		Transfer shorter than this (in byte) is done by CPU synchronously, since setting up the stream and taking
+ * 					the interrupt costs more than the copy itself. The value is an estimate, not yet measured on target, run
+ * 					example/dma/memcpy_benchmark.cpp to find the crossover point of the clock and memory layout in use.
+ */
+static constexpr std::size_t MEM_TRANSFER_CPU_THRESHOLD = 256;
+
+using MemTransferCallback = void (*)() noexcept;
+
+/**
+ * @class 	MemTransfer
+ * @brief		Memory to memory transfer by DMA2 (DMA1 can't access memory as peripheral), transfer longer than 65535
+ * 					data items is split into segments, each of which is started when the previous one completes.
+ * @tparam	Str 					@ref dma::Stream of DMA2
+ * @tparam	CpuThreshold 	See @ref MEM_TRANSFER_CPU_THRESHOLD
+ *
+ * @note 		Data width is the widest one that the address and the length are aligned to, and word transfer of 16 byte
+ * 					aligned addresses uses 4-beat burst. The DMA2 clock must be enabled.
+ */
+template <Stream Str, std::size_t CpuThreshold = MEM_TRANSFER_CPU_THRESHOLD>
+class MemTransfer {
+ private:
+	static constexpr auto DMA					 = Port::DMA2;
+	static constexpr auto IRQ_NUM			 = IrqMap::template getIrqNum<DMA, Str>();
+	static constexpr auto MAX_ITEM_NUM = std::size_t{0xFFFCU};	// multiple of burst size
+	static constexpr auto BURST_ALIGN	 = std::uintptr_t{16U};
+
+	std::uintptr_t m_src{0};
+	std::uintptr_t m_dst{0};
+	std::size_t m_remain{0};	/*!< Number of byte that is not started yet */
+	std::uint32_t m_fillVal{0};
+	bool m_fill{false};
+	MemTransferCallback m_onComplete{nullptr};
+	std::atomic<bool> m_busy{false};
+	std::atomic<bool> m_error{false};
+
+	constexpr MemTransfer() noexcept = default;
+
+	static constexpr auto widthOf(std::uintptr_t const t_align) noexcept {
+		if (t_align % 4U == 0) {
+			return std::pair{DataSize::Word, std::size_t{4}};
+		}
+
+		if (t_align % 2U == 0) {
+			return std::pair{DataSize::HalfWord, std::size_t{2}};
+		}
+
+		return std::pair{DataSize::Byte, std::size_t{1}};
+	}
+
+	void startSegment() noexcept {
+		auto const src_addr = m_fill ? reinterpret_cast<std::uintptr_t>(&m_fillVal) : m_src;
+
+		// the tail that is shorter than the width is transferred by another segment of narrower width
+		auto const [width, item_size]	= widthOf(src_addr | m_dst | std::min(m_remain, std::size_t{4}));
+		auto const item_num						= std::min(m_remain / item_size, MAX_ITEM_NUM);
+
+		bool const burst				= width == DataSize::Word && (m_dst % BURST_ALIGN) == 0 && item_num % 4U == 0;
+		bool const src_burst		= burst && !m_fill && (m_src % BURST_ALIGN) == 0;
+		auto const mem_burst		= burst ? BurstSize::Incr4 : BurstSize::Single;
+		auto const periph_burst	= src_burst ? BurstSize::Incr4 : BurstSize::Single;
+
+		// direct mode is not allowed in memory to memory mode, FIFO is always used
+		auto builder = DmaBuilder<DMA, Str>{}
+										 .transferDir(MemoryAddress_t{src_addr}, MemoryAddress_t{m_dst})
+										 .txDataNum(static_cast<std::uint16_t>(item_num))
+										 .enablePeriphIncrement(!m_fill)
+										 .enableMemIncrement()
+										 .perihperalDataWidth(width)
+										 .memoryDataWidth(width)
+										 .configFIFO(FifoThreshold::Full, PeriphBurstSize_t{periph_burst}, MemoryBurstSize_t{mem_burst});
+
+		auto const segment_size = item_num * item_size;
+		m_src += m_fill ? 0U : segment_size;
+		m_dst += segment_size;
+		m_remain -= segment_size;
+
+		if (m_onComplete != nullptr) {
+			builder.template enableInterrupt<InterruptFlag::TCI, InterruptFlag::TEI>().build();
+		} else {
+			builder.build();
+		}
+	}
+
+	/**
+	 * @brief		This function starts next segment, or finishes the transfer if the segment just completed is the last one
+	 */
+	void advance() noexcept {
+		auto const [tc_flag, te_flag] = get_interrupt_flag<DMA, Str, InterruptFlag::TCI, InterruptFlag::TEI>();
+		if (tc_flag == 0 && te_flag == 0) {
+			return;
+		}
+
+		clear_interrupt_flag<DMA, Str, InterruptFlag::TCI, InterruptFlag::TEI>();
+
+		if (te_flag == 0 && m_remain != 0) {
+			startSegment();
+			return;
+		}
+
+		m_error	= te_flag != 0;
+		m_busy	= false;
+
+		if (m_onComplete != nullptr) {
+			m_onComplete();
+		}
+	}
+
+	void irqHandler() noexcept { advance(); }
+
+	void start(std::uintptr_t const t_dst, std::size_t const t_size, MemTransferCallback const t_cb) noexcept {
+		m_dst				 = t_dst;
+		m_remain		 = t_size;
+		m_onComplete = t_cb;
+		m_error			 = false;
+		m_busy			 = true;
+
+		if (t_cb != nullptr) {
+			nvic::enable_irq<IRQ_NUM>(Callback<&MemTransfer::irqHandler>{this});
+		}
+
+		startSegment();
+	}
+
+ public:
+	MemTransfer(MemTransfer const&) = delete;
+	MemTransfer& operator=(MemTransfer const&) = delete;
+
+	/**
+	 * @brief		This function returns the only transfer handle of the stream
+	 */
+	[[nodiscard]] static MemTransfer& instance() noexcept {
+		static MemTransfer handle;	// constant initialized, no guard
+		return handle;
+	}
+
+	/**
+	 * @brief		This function copies t_size byte from t_src to t_dst, see @ref memcpy_async
+	 * @note 		Transfer shorter than CpuThreshold is copied and t_cb is called here, before return
+	 */
+	void copy(void* const t_dst, void const* const t_src, std::size_t const t_size,
+						MemTransferCallback const t_cb = nullptr) noexcept {
+		wait();
+
+		if (t_size < CpuThreshold) {
+			std::memcpy(t_dst, t_src, t_size);
+			return t_cb != nullptr ? t_cb() : void();
+		}
+
+		m_src	 = reinterpret_cast<std::uintptr_t>(t_src);
+		m_fill = false;
+		start(reinterpret_cast<std::uintptr_t>(t_dst), t_size, t_cb);
+	}
+
+	/**
+	 * @brief		This function sets t_size byte from t_dst to t_val, see @ref memset_async
+	 */
+	void fill(void* const t_dst, std::uint8_t const t_val, std::size_t const t_size,
+						MemTransferCallback const t_cb = nullptr) noexcept {
+		wait();
+
+		if (t_size < CpuThreshold) {
+			std::memset(t_dst, t_val, t_size);
+			return t_cb != nullptr ? t_cb() : void();
+		}
+
+		m_fillVal	= 0x0101'0101U * t_val;
+		m_fill		= true;
+		start(reinterpret_cast<std::uintptr_t>(t_dst), t_size, t_cb);
+	}
+
+	/**
+	 * @brief		This function checks whether the transfer is finished, and starts next segment if the transfer is polled,
+	 * 					i.e. no callback is given
+	 */
+	[[nodiscard]] bool done() noexcept {
+		if (m_busy && m_onComplete == nullptr) {
+			advance();
+		}
+
+		return !m_busy;
+	}
+
+	/**
+	 * @brief		This function checks whether the transfer is stopped by transfer error, e.g. bus error of the address
+	 */
+	[[nodiscard]] bool failed() const noexcept { return m_error; }
+
+	/**
+	 * @brief		This function blocks until the transfer is finished
+	 */
+	void wait() noexcept {
+		while (!done()) {
+		}
+	}
+};
+
+/**
+ * @brief		This function copies memory by DMA2, or by CPU if the size is smaller than @ref MEM_TRANSFER_CPU_THRESHOLD
+ * @tparam	Str 					Stream of DMA2 to use
+ * @tparam	CpuThreshold 	See @ref MEM_TRANSFER_CPU_THRESHOLD
+ * @param 	t_dst 	Destination
+ * @param 	t_src 	Source
+ * @param 	t_size 	Number of byte
+ * @param 	t_cb 		Called in DMA interrupt when finished, or nullptr to poll the returned handle instead
+ * @return	Transfer handle, see @ref MemTransfer::done and @ref MemTransfer::wait
+ *
+ * @note 		The stream serves one transfer at a time, new transfer waits for the previous one.
+ * @note 		Below CpuThreshold, t_cb is called before this function returns, in the context of the caller, not in DMA
+ * 					interrupt.
+ */
+template <Stream Str = Stream::Stream0, std::size_t CpuThreshold = MEM_TRANSFER_CPU_THRESHOLD>
+auto& memcpy_async(void* const t_dst, void const* const t_src, std::size_t const t_size,
+									 MemTransferCallback const t_cb = nullptr) noexcept {
+	auto& handle = MemTransfer<Str, CpuThreshold>::instance();
+	handle.copy(t_dst, t_src, t_size, t_cb);
+	return handle;
+}
+
+/**
+ * @brief		This function fills memory by DMA2, or by CPU if the size is smaller than @ref MEM_TRANSFER_CPU_THRESHOLD
+ * @tparam	Str 					Stream of DMA2 to use
+ * @tparam	CpuThreshold 	See @ref MEM_TRANSFER_CPU_THRESHOLD
+ * @param 	t_dst 	Destination
+ * @param 	t_val 	Value of each byte
+ * @param 	t_size 	Number of byte
+ * @param 	t_cb 		Called in DMA interrupt when finished, or nullptr to poll the returned handle instead
+ * @return	Transfer handle, see @ref MemTransfer::done and @ref MemTransfer::wait
+ *
+ * @note 		Same as @ref memcpy_async, t_cb is called in the context of the caller below CpuThreshold.
+ */
+template <Stream Str = Stream::Stream0, std::size_t CpuThreshold = MEM_TRANSFER_CPU_THRESHOLD>
+auto& memset_async(void* const t_dst, std::uint8_t const t_val, std::size_t const t_size,
+									 MemTransferCallback const t_cb = nullptr) noexcept {
+	auto& handle = MemTransfer<Str, CpuThreshold>::instance();
+	handle.fill(t_dst, t_val, t_size, t_cb);
+	return handle;
+}
+
+}	 // namespace cpp_stm32::dma
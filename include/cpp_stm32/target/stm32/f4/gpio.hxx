@@ -213,6 +213,82 @@ constexpr void clear() noexcept {
 	reg::BSRR<InputPort>.template setBit<Pin{to_underlying(Pins) + HALF_WORD_OFFSET}...>();
 }
 
+/**
+ * @brief		This function sets and clears gpio pins of a port by single store, pins in neither mask are untouched
+ * @tparam 	InputPort @ref gpio::Port
+ * @param 	t_set 		Mask of pins to be set to high
+ * @param 	t_clear 	Mask of pins to be cleared to low, pins in both masks are set
+ */
+template <Port InputPort>
+constexpr void set_clear(std::uint16_t const t_set, std::uint16_t const t_clear) noexcept {
+	constexpr auto HALF_WORD_OFFSET = 16U;
+	MMIO32(reg::BSRR<InputPort>.memoryAddr(), 0) = (std::uint32_t{t_clear} << HALF_WORD_OFFSET) | t_set;
+}
+
+/**
+ * @class 	PortConfig
+ * @brief		Value of all configuration registers of a port, used to configure every pin of a port by one store per
+ * 					register, see @ref write_port_config
+ */
+struct PortConfig {
+	std::uint32_t moder;
+	std::uint32_t otyper;
+	std::uint32_t ospeedr;
+	std::uint32_t pupdr;
+	std::uint32_t afrl;
+	std::uint32_t afrh;
+
+	/**
+	 * @brief		This function sets the fields of a pin
+	 */
+	constexpr void setPin(Pin const t_pin, Mode const t_mode, Pupd const t_pupd, OutputType const t_otype,
+												OutputSpeed const t_ospeed, AltFunc const t_af) noexcept {
+		constexpr auto AFR_PIN_NUM = 8U;
+
+		auto const pin				= std::uint32_t{to_underlying(t_pin)};
+		auto const write_field = [](std::uint32_t& t_reg, std::uint32_t const t_pos, std::uint32_t const t_len,
+																auto const t_val) {
+			auto const mask = ((1U << t_len) - 1U) << t_pos;
+			t_reg						= (t_reg & ~mask) | ((std::uint32_t{to_underlying(t_val)} << t_pos) & mask);
+		};
+
+		write_field(moder, 2U * pin, 2U, t_mode);
+		write_field(otyper, pin, 1U, t_otype);
+		write_field(ospeedr, 2U * pin, 2U, t_ospeed);
+		write_field(pupdr, 2U * pin, 2U, t_pupd);
+		write_field(pin < AFR_PIN_NUM ? afrl : afrh, 4U * (pin % AFR_PIN_NUM), 4U, t_af);
+	}
+};
+
+/**
+ * @brief		This function returns the configuration of a port after reset
+ * @tparam 	InputPort @ref gpio::Port
+ */
+template <Port InputPort>
+constexpr auto reset_port_config() noexcept {
+	return PortConfig{reg::MODER<InputPort>.resetVal(),	reg::OTYPER<InputPort>.resetVal(),
+										reg::OSPEEDR<InputPort>.resetVal(), reg::PUPDR<InputPort>.resetVal(),
+										reg::AFRL<InputPort>.resetVal(),		reg::AFRH<InputPort>.resetVal()};
+}
+
+/**
+ * @brief		This function writes all configuration registers of a port, one store each, without reading them
+ * @tparam 	InputPort @ref gpio::Port
+ * @param 	t_config 	@ref PortConfig
+ *
+ * @note 		MODER is written last, so that a pin leaves input mode with its output type, speed, pull and alternate
+ * 					function in place, instead of driving the pin with the old ones for a moment
+ */
+template <Port InputPort>
+constexpr void write_port_config(PortConfig const& t_config) noexcept {
+	MMIO32(reg::AFRL<InputPort>.memoryAddr(), 0)		= t_config.afrl;
+	MMIO32(reg::AFRH<InputPort>.memoryAddr(), 0)		= t_config.afrh;
+	MMIO32(reg::OTYPER<InputPort>.memoryAddr(), 0)	= t_config.otyper;
+	MMIO32(reg::OSPEEDR<InputPort>.memoryAddr(), 0) = t_config.ospeedr;
+	MMIO32(reg::PUPDR<InputPort>.memoryAddr(), 0)		= t_config.pupdr;
+	MMIO32(reg::MODER<InputPort>.memoryAddr(), 0)		= t_config.moder;
+}
+
 /**
  *
  */
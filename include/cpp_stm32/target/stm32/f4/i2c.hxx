@@ -136,6 +136,27 @@ constexpr void disable_ack() noexcept {
 	reg::CR1<I2C>.template clearBit<reg::CR1Field::ACK>();
 }
 
+/**
+ * @brief   This function sets acknowledge for second byte received in 2 byte receive mode
+ * @tparam  I2C @ref i2c::Port
+ *
+ * @note    The POS bit must be used only in 2-byte reception configuration in master mode. It must be configured before
+ *          data reception starts
+ */
+template <Port I2C>
+constexpr void set_2nd_byte_ack() noexcept {
+	reg::CR1<I2C>.template setBit<reg::CR1Field::POS>();
+}
+
+/**
+ * @brief   This function restores acknowledge for the current byte received, see @ref i2c::set_2nd_byte_ack
+ * @tparam  I2C @ref i2c::Port
+ */
+template <Port I2C>
+constexpr void clear_2nd_byte_ack() noexcept {
+	reg::CR1<I2C>.template clearBit<reg::CR1Field::POS>();
+}
+
 /**
  * @brief 	This function sets the address mode, 7 bit or 10 bit
  * @tparam 	I2C @ref i2c::Port
@@ -324,6 +345,64 @@ constexpr void send_blocking(SlaveAddrType const t_slave, RandIt t_begin, RandIt
 	generate_stop_condition<I2C>();
 }
 
+/**
+ * @brief   This function reads bytes once slave address is acknowledged, i.e. ADDR is set and not cleared yet
+ * @tparam  I2C 		@ref i2c::Port
+ *
+ * @param 	t_buf 	Buffer of received bytes, its size decides the sequence
+ *
+ * @note    ACK must be enabled. The slave is NACKed exactly at the last byte, see RM0390, master receiver:
+ *            - 1 byte: ACK is cleared before ADDR is cleared, STOP is set right after
+ *            - 2 bytes: POS and ACK are cleared before ADDR is cleared, both bytes are read once BTF is set
+ *            - N > 2 bytes: last 3 bytes are read at BTF, ACK is cleared before data N-2 is read, STOP is set before
+ *              data N-1 is read
+ */
+template <Port I2C, std::size_t N>
+constexpr void receive_data(std::array<std::uint8_t, N>& t_buf) noexcept {
+	static_assert(N > 0);
+
+	constexpr auto read_dr = []() { return std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly)); };
+
+	// ADDR is cleared by reading SR1 followed by SR2, SR1 is read while waiting for ADDR
+	constexpr auto clear_addr = []() { [[gnu::unused]] auto const [flag] = get_status<I2C, Status::BUSY>(); };
+
+	if constexpr (N == 1) {
+		disable_ack<I2C>();
+		clear_addr();
+		generate_stop_condition<I2C>();
+
+		wait_status<I2C, InterruptFlag::RxNE>(true);
+		t_buf[0] = read_dr();
+	} else if constexpr (N == 2) {
+		set_2nd_byte_ack<I2C>();
+		disable_ack<I2C>();
+		clear_addr();
+
+		wait_status<I2C, InterruptFlag::BTF>(true);	 // data 1 in DR, data 2 in shift register
+		generate_stop_condition<I2C>();
+		t_buf[0] = read_dr();
+		t_buf[1] = read_dr();
+
+		clear_2nd_byte_ack<I2C>();
+	} else {
+		clear_addr();
+
+		for (std::size_t i = 0; i < N - 3; ++i) {
+			wait_status<I2C, InterruptFlag::RxNE>(true);
+			t_buf[i] = read_dr();
+		}
+
+		wait_status<I2C, InterruptFlag::BTF>(true);	 // data N-2 in DR, data N-1 in shift register
+		disable_ack<I2C>();
+		t_buf[N - 3] = read_dr();
+
+		wait_status<I2C, InterruptFlag::BTF>(true);	 // data N-1 in DR, data N in shift register
+		generate_stop_condition<I2C>();
+		t_buf[N - 2] = read_dr();
+		t_buf[N - 1] = read_dr();
+	}
+}
+
 /**
  * @brief   This function reads byte from data register
  * @tparam  I2C 		@ref i2c::Port
@@ -336,92 +415,10 @@ constexpr void send_blocking(SlaveAddrType const t_slave, RandIt t_begin, RandIt
 template <Port I2C, typename SlaveAddrType, std::uint8_t BC>
 [[nodiscard]] constexpr std::array<std::uint8_t, BC> receive_blocking(SlaveAddrType const t_slave,
 																																			ByteCount<BC> const /*unused*/) noexcept {
-	constexpr auto rcv_byte = []() {
-		wait_status<I2C, InterruptFlag::RxNE>(true);
-		return std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));
-	};
-
 	std::array<std::uint8_t, BC> ret_val{};
 
 	initiaite_comm_process<I2C>(t_slave, Command::Read);
-
-	[[gnu::unused]] auto const [flag] = get_status<I2C, Status::BUSY>();
-
-	std::generate_n(ret_val.begin(), BC - 1, rcv_byte);
-
-	disable_ack<I2C>();
-	ret_val[BC - 1] = rcv_byte();
-	generate_stop_condition<I2C>();
-
-	/* The procedure below follows the reference manual RM0390, however, IMO, it doesn't achieve anything.
-	// See (STM32F10xxx I2C optimized examples) AN2824, and (STM32F446xx advanced Arm-based 32-bit MCUs) RM0390
-	//
-	// if constexpr (BC == 1) {
-	// 	// In case a single byte has to be received, the Acknowledge disable is made before ADDR flag is cleared, and the
-	// 	// STOP condition generation is made after data received.
-	// 	disable_ack<I2C>();
-	// 	[[gnu::unused]] auto const [flag] = get_status<I2C, Status::BUSY>();
-	//
-	// 	ret_val[0] = std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));
-	//
-	// 	generate_stop_condition<I2C>();
-	// } else if (BC == 2) {
-	// 	// For 2-byte reception:
-	// 	//	1. Wait until ADDR = 1 (SCL stretched low until the ADDR flag is cleared)
-	// 	//  2. Set ACK low, set POS high
-	// 	//  3. Clear ADDR flag
-	// 	//  4. Wait until BTF = 1 (Data 1 in DR, Data2 in shift register, SCL stretched low until a data 1 is read)
-	// 	//  5. Set STOP high
-	// 	//  6. Read data 1 and 2
-	//
-	// 	disable_ack<I2C>();
-	// 	reg::CR1<I2C>.template setBit<reg::CR1Field::POS>();
-	//
-	// 	// @todo, the flag is arbitrarily chosen, which makes the purpose of this line of code unclear, improve this
-	// 	// @note: ADDR bit (Master) when = 0: No end of address transmission. ADDR bit is cleared by reading SR1 then SR2
-	// 	[[gnu::unused]] auto const [flag] = get_status<I2C, Status::BUSY>();
-	//
-	// 	wait_byte_tx_finish();
-	// 	generate_stop_condition<I2C>();
-	//
-	// 	ret_val[0] = std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));
-	// 	ret_val[1] = std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));
-	// } else {
-	// 	// For N > 2 byte reception, from N-2 data reception
-	// 	// 	1. Wait until BTF = 1 (data N-2 in DR, data N-1 in shift register, SCL stretched low until data N-2 is read)
-	// 	//  2. Set ACK low
-	// 	//  3. Read data N-2
-	// 	//  4. Wait until BTF = 1 (data N-1 in DR, data N in shift register, SCL stretched low until a data N-1 is read)
-	// 	//  5. Set STOP high
-	// 	//  6. Read data N-1 and N
-	//
-	// 	[[gnu::unused]] auto const [flag] = get_status<I2C, Status::BUSY>();
-	//
-	// 	// using raw loop instead of std algorithm as it can only increment iterator by one (poor algorithm)
-	// 	for (int i = 0; i < BC - 3; i += 2) {
-	// 		wait_rxne();
-	// 		ret_val[i] = std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));
-	//
-	//    // wait byte transfer finish
-	// 		while(std::get<0>(reg::SR1<I2C>.template readBit<reg::SR1Field::BTF>(ValueOnly)) != 1) {
-	//		}
-	//    ret_val[i + 1] = std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));
-	// 	}
-	//
-	// 	// To generate the nonacknowledge pulse after the last received data byte, the ACK bit
-	// 	// must be cleared just after reading the second last data byte (after second last event).
-	// 	while(std::get<0>(reg::SR1<I2C>.template readBit<reg::SR1Field::BTF>(ValueOnly)) != 1) {
-	//	}
-	// 	disable_ack<I2C>();
-	//	ret_val[BC - 3] = std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));	// 3rd last byte
-	//
-	// 	// In order to generate the Stop/Restart condition, software must set the STOP/START after reading the second last
-	// 	// data byte (after the second last RxNE event).
-	// 	generate_stop_condition<I2C>();
-	// 	ret_val[BC - 2] = std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));	// 2nd last byte
-	//  ret_val[BC - 1] = std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));	// last byte
-	// }
-	*/
+	receive_data<I2C>(ret_val);
 
 	return ret_val;
 }
@@ -445,11 +442,6 @@ template <Port I2C, typename SlaveAddrType, typename RandIt, std::uint8_t BC>
 		wait_status<I2C, InterruptFlag::BTF>(true);
 	};
 
-	constexpr auto rcv_byte = []() {
-		wait_status<I2C, InterruptFlag::RxNE>(true);
-		return std::get<0>(reg::DR<I2C>.template readBit<reg::DRField::DR>(ValueOnly));
-	};
-
 	initiaite_comm_process<I2C>(t_slave, Command::Write);
 
 	// @todo, the flag is arbitrarily chosen, which makes the purpose of this line of code unclear, improve this
@@ -459,20 +451,12 @@ template <Port I2C, typename SlaveAddrType, typename RandIt, std::uint8_t BC>
 	std::for_each(begin, end, transfer_byte);
 
 	if constexpr (BC > 0) {
+		// repeated start is generated after BTF of the last byte written
 		initiaite_comm_process<I2C>(t_slave, Command::ReadAfterWrite);
 
-		// @todo, the flag is arbitrarily chosen, which makes the purpose of this line of code unclear, improve this
-		// @note: Address sent (Master) = 0: No end of address transmission, cleared by reading SR1 then SR2
-		get_status<I2C, Status::BUSY>();
-
 		std::array<std::uint8_t, BC> ret_val{};
+		receive_data<I2C>(ret_val);
 
-		std::generate_n(ret_val.begin(), BC - 1, rcv_byte);
-
-		disable_ack<I2C>();
-		ret_val[BC - 1] = rcv_byte();
-
-		generate_stop_condition<I2C>();
 		return ret_val;
 	}
 
@@ -602,18 +586,6 @@ constexpr void disable_clock_stretch() noexcept {
 	reg::CR1<I2C>.template setBit<reg::CR1Field::NOSTRETCH>();
 }
 
-/**
- * @brief   This function sets acknowledge for second byte received in 2 byte receive mode
- * @tparam  I2C @ref i2c::Port
- *
- * @note    The POS bit must be used only in 2-byte reception configuration in master mode. It must be configured before
- *          data reception starts
- */
-// template <Port I2C>
-// constexpr void set_2nd_byte_ack() noexcept {
-// 	reg::CR1<I2C>.template setBit<reg::CR1Field::POS>();
-// }
-
 /**
  * @brief   This function enables interrupt according to interrupt flags
  * @tparam  I2C   @ref i2c::Port
@@ -733,13 +705,24 @@ constexpr void disable_dma() noexcept {
 }
 
 /**
- * [set_dma_last_transfer description]
+ * @brief   This function marks the next DMA end of transfer as the last one of the reception, so that the last byte
+ *          received by DMA is NACKed
+ * @tparam  I2C @ref i2c::Port
  *
- * @todo maybe add dma namespace here, and put this function inside dma namespace
+ * @note    STOP must still be generated by software, in DMA transfer complete interrupt
  */
-// template <Port I2C>
-// constexpr void set_dma_last_transfer() noexcept {
-//
-// }
+template <Port I2C>
+constexpr void set_dma_last_transfer() noexcept {
+	reg::CR2<I2C>.template setBit<reg::CR2Field::LAST>();
+}
+
+/**
+ * @brief   This function clears the last transfer mark, see @ref i2c::set_dma_last_transfer
+ * @tparam  I2C @ref i2c::Port
+ */
+template <Port I2C>
+constexpr void clear_dma_last_transfer() noexcept {
+	reg::CR2<I2C>.template clearBit<reg::CR2Field::LAST>();
+}
 
 }	// namespace cpp_stm32::i2c
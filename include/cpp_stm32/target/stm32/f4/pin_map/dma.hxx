@@ -0,0 +1,157 @@
+/**
+ * @file  stm32/f4/pin_map/dma.hxx
+ * @brief	DMA stream mapping for stm32f4
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "cpp_stm32/target/stm32/f4/define/dma.hxx"
+#include "cpp_stm32/target/stm32/f4/interrupt.hxx"
+#include "cpp_stm32/utility/utility.hxx"
+
+namespace cpp_stm32::dma {
+
+class IrqMap {
+ private:
+	static constexpr std::array DMA1_IRQ{IrqNum::Dma1Stream0Global, IrqNum::Dma1Stream1Global, IrqNum::Dma1Stream2Global,
+																			 IrqNum::Dma1Stream3Global, IrqNum::Dma1Stream4Global, IrqNum::Dma1Stream5Global,
+																			 IrqNum::Dma1Stream6Global, IrqNum::Dma1Stream7Global};
+
+	static constexpr std::array DMA2_IRQ{IrqNum::Dma2Stream0Global, IrqNum::Dma2Stream1Global, IrqNum::Dma2Stream2Global,
+																			 IrqNum::Dma2Stream3Global, IrqNum::Dma2Stream4Global, IrqNum::Dma2Stream5Global,
+																			 IrqNum::Dma2Stream6Global, IrqNum::Dma2Stream7Global};
+
+ public:
+	template <Port DMA, Stream Str>
+	[[nodiscard]] static constexpr auto getIrqNum() noexcept {
+		if constexpr (DMA == Port::DMA1) {
+			return DMA1_IRQ[to_underlying(Str)];
+		} else {
+			return DMA2_IRQ[to_underlying(Str)];
+		}
+	}
+};
+
+/**
+ * @class 	RequestMap
+ * @brief		DMA request mapping of stm32f446, see RM0390 table 28 and 29. For requests that can be routed to more
+ * 					than one stream, the one listed first is preferred by @ref StreamAllocator.
+ */
+class RequestMap {
+ private:
+	struct RequestData {
+		Request request;
+		StreamMapping mapping;
+	};
+
+	static constexpr std::array REQUEST_TABLE{
+		RequestData{Request::Spi3Rx, StreamMapping{Port::DMA1, Stream::Stream0, Channel::Channel0}},
+		RequestData{Request::Spi3Rx, StreamMapping{Port::DMA1, Stream::Stream2, Channel::Channel0}},
+		RequestData{Request::Spi3Tx, StreamMapping{Port::DMA1, Stream::Stream5, Channel::Channel0}},
+		RequestData{Request::Spi3Tx, StreamMapping{Port::DMA1, Stream::Stream7, Channel::Channel0}},
+		RequestData{Request::Spi2Rx, StreamMapping{Port::DMA1, Stream::Stream3, Channel::Channel0}},
+		RequestData{Request::Spi2Tx, StreamMapping{Port::DMA1, Stream::Stream4, Channel::Channel0}},
+		RequestData{Request::I2c1Rx, StreamMapping{Port::DMA1, Stream::Stream0, Channel::Channel1}},
+		RequestData{Request::I2c1Rx, StreamMapping{Port::DMA1, Stream::Stream5, Channel::Channel1}},
+		RequestData{Request::I2c1Tx, StreamMapping{Port::DMA1, Stream::Stream6, Channel::Channel1}},
+		RequestData{Request::I2c1Tx, StreamMapping{Port::DMA1, Stream::Stream7, Channel::Channel1}},
+		RequestData{Request::I2c3Rx, StreamMapping{Port::DMA1, Stream::Stream2, Channel::Channel3}},
+		RequestData{Request::I2c3Tx, StreamMapping{Port::DMA1, Stream::Stream4, Channel::Channel3}},
+		RequestData{Request::I2c2Rx, StreamMapping{Port::DMA1, Stream::Stream2, Channel::Channel7}},
+		RequestData{Request::I2c2Rx, StreamMapping{Port::DMA1, Stream::Stream3, Channel::Channel7}},
+		RequestData{Request::I2c2Tx, StreamMapping{Port::DMA1, Stream::Stream7, Channel::Channel7}},
+		RequestData{Request::Uart5Rx, StreamMapping{Port::DMA1, Stream::Stream0, Channel::Channel4}},
+		RequestData{Request::Usart3Rx, StreamMapping{Port::DMA1, Stream::Stream1, Channel::Channel4}},
+		RequestData{Request::Uart4Rx, StreamMapping{Port::DMA1, Stream::Stream2, Channel::Channel4}},
+		RequestData{Request::Usart3Tx, StreamMapping{Port::DMA1, Stream::Stream3, Channel::Channel4}},
+		RequestData{Request::Usart3Tx, StreamMapping{Port::DMA1, Stream::Stream4, Channel::Channel7}},
+		RequestData{Request::Uart4Tx, StreamMapping{Port::DMA1, Stream::Stream4, Channel::Channel4}},
+		RequestData{Request::Usart2Rx, StreamMapping{Port::DMA1, Stream::Stream5, Channel::Channel4}},
+		RequestData{Request::Usart2Tx, StreamMapping{Port::DMA1, Stream::Stream6, Channel::Channel4}},
+		RequestData{Request::Uart5Tx, StreamMapping{Port::DMA1, Stream::Stream7, Channel::Channel4}},
+		RequestData{Request::Dac1, StreamMapping{Port::DMA1, Stream::Stream5, Channel::Channel7}},
+		RequestData{Request::Dac2, StreamMapping{Port::DMA1, Stream::Stream6, Channel::Channel7}},
+		RequestData{Request::Adc1, StreamMapping{Port::DMA2, Stream::Stream0, Channel::Channel0}},
+		RequestData{Request::Adc1, StreamMapping{Port::DMA2, Stream::Stream4, Channel::Channel0}},
+		RequestData{Request::Adc2, StreamMapping{Port::DMA2, Stream::Stream2, Channel::Channel1}},
+		RequestData{Request::Adc2, StreamMapping{Port::DMA2, Stream::Stream3, Channel::Channel1}},
+		RequestData{Request::Adc3, StreamMapping{Port::DMA2, Stream::Stream0, Channel::Channel2}},
+		RequestData{Request::Adc3, StreamMapping{Port::DMA2, Stream::Stream1, Channel::Channel2}},
+		RequestData{Request::Spi1Rx, StreamMapping{Port::DMA2, Stream::Stream0, Channel::Channel3}},
+		RequestData{Request::Spi1Rx, StreamMapping{Port::DMA2, Stream::Stream2, Channel::Channel3}},
+		RequestData{Request::Spi1Tx, StreamMapping{Port::DMA2, Stream::Stream3, Channel::Channel3}},
+		RequestData{Request::Spi1Tx, StreamMapping{Port::DMA2, Stream::Stream5, Channel::Channel3}},
+		RequestData{Request::Spi4Rx, StreamMapping{Port::DMA2, Stream::Stream0, Channel::Channel4}},
+		RequestData{Request::Spi4Rx, StreamMapping{Port::DMA2, Stream::Stream3, Channel::Channel5}},
+		RequestData{Request::Spi4Tx, StreamMapping{Port::DMA2, Stream::Stream1, Channel::Channel4}},
+		RequestData{Request::Spi4Tx, StreamMapping{Port::DMA2, Stream::Stream4, Channel::Channel5}},
+		RequestData{Request::Usart1Rx, StreamMapping{Port::DMA2, Stream::Stream2, Channel::Channel4}},
+		RequestData{Request::Usart1Rx, StreamMapping{Port::DMA2, Stream::Stream5, Channel::Channel4}},
+		RequestData{Request::Usart1Tx, StreamMapping{Port::DMA2, Stream::Stream7, Channel::Channel4}},
+		RequestData{Request::Usart6Rx, StreamMapping{Port::DMA2, Stream::Stream1, Channel::Channel5}},
+		RequestData{Request::Usart6Rx, StreamMapping{Port::DMA2, Stream::Stream2, Channel::Channel5}},
+		RequestData{Request::Usart6Tx, StreamMapping{Port::DMA2, Stream::Stream6, Channel::Channel5}},
+		RequestData{Request::Usart6Tx, StreamMapping{Port::DMA2, Stream::Stream7, Channel::Channel5}},
+		RequestData{Request::MemToMem, StreamMapping{Port::DMA2, Stream::Stream0, Channel::Channel0}},
+		RequestData{Request::MemToMem, StreamMapping{Port::DMA2, Stream::Stream1, Channel::Channel0}},
+		RequestData{Request::MemToMem, StreamMapping{Port::DMA2, Stream::Stream2, Channel::Channel0}},
+		RequestData{Request::MemToMem, StreamMapping{Port::DMA2, Stream::Stream3, Channel::Channel0}},
+		RequestData{Request::MemToMem, StreamMapping{Port::DMA2, Stream::Stream4, Channel::Channel0}},
+		RequestData{Request::MemToMem, StreamMapping{Port::DMA2, Stream::Stream5, Channel::Channel0}},
+		RequestData{Request::MemToMem, StreamMapping{Port::DMA2, Stream::Stream6, Channel::Channel0}},
+		RequestData{Request::MemToMem, StreamMapping{Port::DMA2, Stream::Stream7, Channel::Channel0}},
+	};
+
+ public:
+	/**
+	 * @brief		This function returns number of stream the request can be routed to
+	 */
+	[[nodiscard]] static constexpr std::size_t getMappingNum(Request const t_req) noexcept {
+		std::size_t ret_val = 0;
+		for (auto const& [request, mapping] : REQUEST_TABLE) {
+			ret_val += static_cast<std::size_t>(request == t_req);
+		}
+
+		return ret_val;
+	}
+
+	/**
+	 * @brief		This function returns the t_idx-th stream the request can be routed to
+	 * @param 	t_req 	DMA request
+	 * @param 	t_idx 	Less than @ref getMappingNum
+	 */
+	[[nodiscard]] static constexpr StreamMapping getMapping(Request const t_req, std::size_t t_idx) noexcept {
+		for (auto const& [request, mapping] : REQUEST_TABLE) {
+			if (request == t_req && t_idx-- == 0) {
+				return mapping;
+			}
+		}
+
+		return StreamMapping{};
+	}
+
+	template <Request Req>
+	static constexpr bool IS_MAPPED = getMappingNum(Req) != 0;
+};
+
+}	 // namespace cpp_stm32::dma
@@ -42,7 +42,7 @@ class PinMap {
 	static constexpr std::array RCC{rcc::PeriphClk::I2c1, rcc::PeriphClk::I2c2, rcc::PeriphClk::I2c3};
 	static constexpr std::array IRQ{std::array{IrqNum::I2c1Ev, IrqNum::I2c1Er},
 																	std::array{IrqNum::I2c2Ev, IrqNum::I2c2Er},
-																	std::array{IrqNum::I2c2Ev, IrqNum::I2c2Er}};	// @todo change to i2c3ev, i2c3er
+																	std::array{IrqNum::I2c3Ev, IrqNum::I2c3Er}};
 
 	static constexpr auto SET_DATA = [](gpio::PinName const t_pin, Port const t_port) {
 		auto const idx = to_underlying(t_port);
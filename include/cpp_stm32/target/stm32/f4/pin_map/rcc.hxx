@@ -25,11 +25,17 @@
 #include <tuple>
 #include <utility>
 
+#include "cpp_stm32/target/stm32/f4/define/gpio.hxx"
 #include "cpp_stm32/target/stm32/f4/define/rcc.hxx"
 #include "cpp_stm32/target/stm32/f4/register/rcc.hxx"
 
 namespace cpp_stm32::rcc {
 
+// GpioUtil and BoardPinConfig enable the clock of GPIO port by casting gpio::Port to PeriphClk
+static_assert(to_underlying(PeriphClk::GpioA) == to_underlying(gpio::Port::PortA) &&
+									to_underlying(PeriphClk::GpioH) == to_underlying(gpio::Port::PortH),
+							"GPIO entries of PeriphClk must be in the order of gpio::Port");
+
 class ClkRegMap {
  private:
 	static constexpr std::tuple PERIPH_CLK_RST_TABLE{
@@ -37,7 +43,13 @@ class ClkRegMap {
 		std::pair{reg::AHB1RST, reg::Ahb1RstBit::GpioARst},
 		std::pair{reg::AHB1RST, reg::Ahb1RstBit::GpioBRst},
 		std::pair{reg::AHB1RST, reg::Ahb1RstBit::GpioCRst},
+		std::pair{reg::AHB1RST, reg::Ahb1RstBit::GpioDRst},
+		std::pair{reg::AHB1RST, reg::Ahb1RstBit::GpioERst},
+		std::pair{reg::AHB1RST, reg::Ahb1RstBit::GpioFRst},
+		std::pair{reg::AHB1RST, reg::Ahb1RstBit::GpioGRst},
+		std::pair{reg::AHB1RST, reg::Ahb1RstBit::GpioHRst},
 
+		std::pair{reg::AHB1RST, reg::Ahb1RstBit::CrcRst},
 		std::pair{reg::AHB1RST, reg::Ahb1RstBit::Dma1Rst},
 		std::pair{reg::AHB1RST, reg::Ahb1RstBit::Dma2Rst},
 		/*APB1*/
@@ -63,7 +75,13 @@ class ClkRegMap {
 		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::GpioAEn},
 		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::GpioBEn},
 		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::GpioCEn},
+		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::GpioDEn},
+		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::GpioEEn},
+		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::GpioFEn},
+		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::GpioGEn},
+		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::GpioHEn},
 
+		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::CrcEn},
 		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::Dma1En},
 		std::pair{reg::AHB1ENR, reg::Ahb1EnrBit::Dma2En},
 		/*APB1*/
@@ -35,13 +35,21 @@
 
 namespace cpp_stm32::rcc {
 
-// extend en and rst so that it takes template param pack
-template <PeriphClk Clk>
+/**
+ * @brief		This function enables the peripheral clock
+ * @tparam	Clk		Peripheral clock @ref rcc::PeriphClk
+ * @tparam	Clks	Other peripheral clocks enabled by the same register write, they must be in the same register as Clk
+ */
+template <PeriphClk Clk, PeriphClk... Clks>
 constexpr void enable_periph_clk() noexcept {
 	constexpr auto reg_bit_pair = ClkRegMap::template getPeriphEnReg<Clk>();
 	constexpr auto CTL_REG			= std::get<0>(reg_bit_pair);
 	constexpr auto enable_bit		= std::get<1>(reg_bit_pair);
-	CTL_REG.template setBit<enable_bit>();
+
+	static_assert(((std::get<0>(ClkRegMap::template getPeriphEnReg<Clks>()).memoryAddr() == CTL_REG.memoryAddr()) && ...),
+								"Peripheral clocks are not enabled by the same register");
+
+	CTL_REG.template setBit<enable_bit, std::get<1>(ClkRegMap::template getPeriphEnReg<Clks>())...>();
 }
 
 /**
@@ -0,0 +1,83 @@
+/**
+ * @file  stm32/f4/register/crc.hxx
+ * @brief	CRC calculation unit registers of stm32f4
+ */
+
+/** Copyright (c) 2020 by osjacky430.
+ * All Rights Reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the Lesser GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Lesser GNU General Public License for more details.
+ *
+ * You should have received a copy of the Lesser GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "cpp_stm32/hal/bit.hxx"
+#include "cpp_stm32/hal/register.hxx"
+
+namespace cpp_stm32::crc::reg {
+
+static constexpr auto BASE_ADDR = 0x40023000U;
+
+/**
+ * @defgroup	CRC_DR_GROUP		Data register group
+ *
+ * @{
+ */
+
+SETUP_REGISTER_INFO(DRBitList,												 /**/
+										Bit<32, std::uint32_t>{BitPos_t{0}}	 // DR
+)
+
+enum class DRField {
+	DR, /*!< Data register, write to feed the unit, read to get the result */
+};
+
+static constexpr Register<DRBitList, DRField> DR{BASE_ADDR, 0x00U, ResetVal_t{0xFFFFFFFFU}};
+/**@}*/
+
+/**
+ * @defgroup	CRC_IDR_GROUP		Independent data register group
+ *
+ * @{
+ */
+
+SETUP_REGISTER_INFO(IDRBitList,						/**/
+										Bit<8>{BitPos_t{0}}	 // IDR
+)
+
+enum class IDRField {
+	IDR, /*!< General purpose 8 bit storage, not affected by reset of the unit */
+};
+
+static constexpr Register<IDRBitList, IDRField> IDR{BASE_ADDR, 0x04U};
+/**@}*/
+
+/**
+ * @defgroup	CRC_CR_GROUP		Control register group
+ *
+ * @{
+ */
+
+SETUP_REGISTER_INFO(CRBitList,												 /**/
+										Binary<BitMod::WrOnly>{BitPos_t{0}}	 // RESET
+)
+
+enum class CRField {
+	RESET, /*!< Resets data register to 0xFFFFFFFF */
+};
+
+static constexpr Register<CRBitList, CRField> CR{BASE_ADDR, 0x08U};
+/**@}*/
+
+}	 // namespace cpp_stm32::crc::reg
@@ -39,6 +39,11 @@ static constexpr auto BASE_ADDR(Port const& t_dma) {
 	}
 }
 
+/**
+ * @brief	The peripheral registers can only be accessed by words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word;
+
 /**
  * @defgroup	DMA1_LISR_GROUP		low interrupt status register group
  *
@@ -54,7 +59,7 @@ SETUP_REGISTER_INFO(LISRBitList,																									/**/
 )
 
 template <Port DMA>
-static constexpr Register<LISRBitList, InterruptFlag> LISR{BASE_ADDR(DMA), 0x00U};
+static constexpr Register<LISRBitList, InterruptFlag, PERIPH_ACCESS> LISR{BASE_ADDR(DMA), 0x00U};
 /**@}*/
 
 /**
@@ -72,7 +77,7 @@ SETUP_REGISTER_INFO(HISRBitList,																									/**/
 )
 
 template <Port DMA>
-static constexpr Register<HISRBitList, InterruptFlag> HISR{BASE_ADDR(DMA), 0x04U};
+static constexpr Register<HISRBitList, InterruptFlag, PERIPH_ACCESS> HISR{BASE_ADDR(DMA), 0x04U};
 /**@}*/
 
 /**
@@ -81,16 +86,16 @@ static constexpr Register<HISRBitList, InterruptFlag> HISR{BASE_ADDR(DMA), 0x04U
  * @{
  */
 
-SETUP_REGISTER_INFO(LIFCRBitList,																									/**/
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<0, 6, 16, 22>),		// CFEI
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<2, 8, 18, 24>),		// CDMEI
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<3, 9, 19, 25>),		// CTEI
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<4, 10, 20, 26>),	// CHTI
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<5, 11, 21, 27>)		// CTCI
+SETUP_REGISTER_INFO(LIFCRBitList,																														/**/
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<0, 6, 16, 22>),		// CFEI
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<2, 8, 18, 24>),		// CDMEI
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<3, 9, 19, 25>),		// CTEI
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<4, 10, 20, 26>),	// CHTI
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<5, 11, 21, 27>)		// CTCI
 )
 
 template <Port DMA>
-static constexpr Register<LIFCRBitList, InterruptFlag> LIFCR{BASE_ADDR(DMA), 0x08U};
+static constexpr Register<LIFCRBitList, InterruptFlag, PERIPH_ACCESS> LIFCR{BASE_ADDR(DMA), 0x08U};
 /**@}*/
 
 /**
@@ -99,16 +104,16 @@ static constexpr Register<LIFCRBitList, InterruptFlag> LIFCR{BASE_ADDR(DMA), 0x0
  * @{
  */
 
-SETUP_REGISTER_INFO(HIFCRBitList,																									/**/
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<0, 6, 16, 22>),		// CFEI
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<2, 8, 18, 24>),		// CDMEI
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<3, 9, 19, 25>),		// CTEI
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<4, 10, 20, 26>),	// CHTI
-										CREATE_LIST_OF_BITS<StatusBit<1>>(BitPosSeq<5, 11, 21, 27>)		// CTCI
+SETUP_REGISTER_INFO(HIFCRBitList,																														/**/
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<0, 6, 16, 22>),		// CFEI
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<2, 8, 18, 24>),		// CDMEI
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<3, 9, 19, 25>),		// CTEI
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<4, 10, 20, 26>),	// CHTI
+										CREATE_LIST_OF_BITS<Binary<BitMod::WrOnly>>(BitPosSeq<5, 11, 21, 27>)		// CTCI
 )
 
 template <Port DMA>
-static constexpr Register<HIFCRBitList, InterruptFlag> HIFCR{BASE_ADDR(DMA), 0x0cU};
+static constexpr Register<HIFCRBitList, InterruptFlag, PERIPH_ACCESS> HIFCR{BASE_ADDR(DMA), 0x0cU};
 /**@}*/
 
 /**
@@ -161,8 +166,13 @@ enum class SxCRField {
 	CHSEL,	/*!< Channel selection*/
 };
 
+/**
+ * @note 	EN is cleared by hardware at the end of transfer, and CT is toggled by hardware in double buffer mode, therefore
+ * 				they are read from the register unless they are written together with other bits.
+ */
 template <Port DMA, Stream Str>
-static constexpr Register<SxCRBitList, SxCRField> SxCR{BASE_ADDR(DMA), 0x10 + 0x18U * to_underlying(Str)};
+inline constexpr CachedRegister<SxCRBitList, SxCRField, PERIPH_ACCESS, HwModified<SxCRField::EN, SxCRField::CT>> SxCR{
+	BASE_ADDR(DMA), 0x10 + 0x18U * to_underlying(Str)};
 /**@}*/
 
 /**
@@ -180,7 +190,8 @@ enum class SxNDTRField {
 };
 
 template <Port DMA, Stream Str>
-static constexpr Register<SxNDTRBitList, SxNDTRField> SxNDTR{BASE_ADDR(DMA), 0x14U + 0x18 * to_underlying(Str)};
+static constexpr Register<SxNDTRBitList, SxNDTRField, PERIPH_ACCESS> SxNDTR{BASE_ADDR(DMA),
+																																						0x14U + 0x18 * to_underlying(Str)};
 /**@}*/
 
 /**
@@ -198,7 +209,8 @@ enum class SxPARField {
 };
 
 template <Port DMA, Stream Str>
-static constexpr Register<SxPARBitList, SxPARField> SxPAR{BASE_ADDR(DMA), 0x18 + 0x18U * to_underlying(Str)};
+static constexpr Register<SxPARBitList, SxPARField, PERIPH_ACCESS> SxPAR{BASE_ADDR(DMA),
+																																				 0x18 + 0x18U * to_underlying(Str)};
 /**@}*/
 
 /**
@@ -216,7 +228,8 @@ enum class SxM0ARField {
 };
 
 template <Port DMA, Stream Str>
-static constexpr Register<SxM0ARBitList, SxM0ARField> SxM0AR{BASE_ADDR(DMA), 0x1CU + 0x18 * to_underlying(Str)};
+static constexpr Register<SxM0ARBitList, SxM0ARField, PERIPH_ACCESS> SxM0AR{BASE_ADDR(DMA),
+																																						0x1CU + 0x18 * to_underlying(Str)};
 /**@}*/
 
 /**
@@ -234,7 +247,8 @@ enum class SxM1ARField {
 };
 
 template <Port DMA, Stream Str>
-static constexpr Register<SxM1ARBitList, SxM1ARField> SxM1AR{BASE_ADDR(DMA), 0x20U + 0x18 * to_underlying(Str)};
+static constexpr Register<SxM1ARBitList, SxM1ARField, PERIPH_ACCESS> SxM1AR{BASE_ADDR(DMA),
+																																						0x20U + 0x18 * to_underlying(Str)};
 /**@}*/
 
 /**
@@ -258,8 +272,8 @@ enum class SxFCRField {
 };
 
 template <Port DMA, Stream Str>
-static constexpr Register<SxFCRBitList, SxFCRField> SxFCR{BASE_ADDR(DMA),											//
-																													0x24U + 0x24 * to_underlying(Str),	//
+static constexpr Register<SxFCRBitList, SxFCRField, PERIPH_ACCESS> SxFCR{BASE_ADDR(DMA),											//
+																													0x24U + 0x18U * to_underlying(Str),	//
 																													ResetVal_t{0x0000'0021}};
 /**@}*/
 
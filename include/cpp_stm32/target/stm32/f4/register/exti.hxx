@@ -31,6 +31,11 @@ namespace cpp_stm32::exti::reg {
 
 static constexpr auto BASE_ADDR = 0x40013c00U;
 
+/**
+ * @brief	The peripheral registers can only be accessed by words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word;
+
 SETUP_REGISTER_INFO(ExtiBitList, CREATE_LIST_OF_BITS<Binary<>>(detail::IdxRange<0, 22>{}))
 
 /**
@@ -39,7 +44,7 @@ SETUP_REGISTER_INFO(ExtiBitList, CREATE_LIST_OF_BITS<Binary<>>(detail::IdxRange<
  * @{
  */
 
-static constexpr Register<ExtiBitList, Line> IMR{BASE_ADDR, 0x00U};
+static constexpr Register<ExtiBitList, Line, PERIPH_ACCESS> IMR{BASE_ADDR, 0x00U};
 /**@}*/
 
 /**
@@ -48,7 +53,7 @@ static constexpr Register<ExtiBitList, Line> IMR{BASE_ADDR, 0x00U};
  * @{
  */
 
-static constexpr Register<ExtiBitList, Line> EMR{BASE_ADDR, 0x04U};
+static constexpr Register<ExtiBitList, Line, PERIPH_ACCESS> EMR{BASE_ADDR, 0x04U};
 /**@}*/
 
 /**
@@ -57,7 +62,7 @@ static constexpr Register<ExtiBitList, Line> EMR{BASE_ADDR, 0x04U};
  * @{
  */
 
-static constexpr Register<ExtiBitList, Line> RTSR{BASE_ADDR, 0x08U};
+static constexpr Register<ExtiBitList, Line, PERIPH_ACCESS> RTSR{BASE_ADDR, 0x08U};
 /**@}*/
 
 /**
@@ -66,7 +71,7 @@ static constexpr Register<ExtiBitList, Line> RTSR{BASE_ADDR, 0x08U};
  * @{
  */
 
-static constexpr Register<ExtiBitList, Line> FTSR{BASE_ADDR, 0x0cU};
+static constexpr Register<ExtiBitList, Line, PERIPH_ACCESS> FTSR{BASE_ADDR, 0x0cU};
 /**@}*/
 
 /**
@@ -75,7 +80,7 @@ static constexpr Register<ExtiBitList, Line> FTSR{BASE_ADDR, 0x0cU};
  * @{
  */
 
-static constexpr Register<ExtiBitList, Line> SWIER{BASE_ADDR, 0x10U};
+static constexpr Register<ExtiBitList, Line, PERIPH_ACCESS> SWIER{BASE_ADDR, 0x10U};
 /**@}*/
 
 /**
@@ -86,7 +91,7 @@ static constexpr Register<ExtiBitList, Line> SWIER{BASE_ADDR, 0x10U};
 
 SETUP_REGISTER_INFO(PRBitList, CREATE_LIST_OF_BITS<Binary<BitMod::RdClrWr1>>(detail::IdxRange<0, 22>{}))
 
-static constexpr Register<PRBitList, Line> PR{BASE_ADDR, 0x14U};
+static constexpr Register<PRBitList, Line, PERIPH_ACCESS> PR{BASE_ADDR, 0x14U};
 /**@}*/
 
 }	 // namespace cpp_stm32::exti::reg
@@ -61,8 +61,16 @@ struct AFHRIdxPolicy {
 SETUP_REGISTER_INFO(GpioModerInfo, /**/
 										CREATE_LIST_OF_BITS<Bit<2, Mode>>(detail::IdxRange<0, 30, 2>{}));
 
+/**
+ * @brief		Port A and B reset to debug pins (SWD/JTAG) in alternate function mode
+ */
+constexpr auto MODER_RESET_VAL(Port const t_port) noexcept {
+	return ResetVal_t{t_port == Port::PortA ? 0xA800'0000U : (t_port == Port::PortB ? 0x0000'0280U : 0x0U)};
+}
+
 template <Port GPIO>
-static constexpr GpioReg<GpioModerInfo, atomicity(BASE_ADDR(GPIO) + 0x00U)> MODER{BASE_ADDR(GPIO), 0x00U};
+static constexpr GpioReg<GpioModerInfo, atomicity(BASE_ADDR(GPIO) + 0x00U)> MODER{BASE_ADDR(GPIO), 0x00U,
+																																									 MODER_RESET_VAL(GPIO)};
 
 /**@}*/
 
@@ -88,8 +96,13 @@ static constexpr GpioReg<OTYPERBitList, atomicity(BASE_ADDR(GPIO) + 0x04U)> OTYP
 SETUP_REGISTER_INFO(OSPEEDRBitList, /**/
 										CREATE_LIST_OF_BITS<Bit<2, OutputSpeed>>(detail::IdxRange<0, 30, 2>{}))
 
+constexpr auto OSPEEDR_RESET_VAL(Port const t_port) noexcept {
+	return ResetVal_t{t_port == Port::PortA ? 0x0C00'0000U : (t_port == Port::PortB ? 0x0000'00C0U : 0x0U)};
+}
+
 template <Port GPIO>
-static constexpr GpioReg<OSPEEDRBitList, atomicity(BASE_ADDR(GPIO) + 0x08U)> OSPEEDR{BASE_ADDR(GPIO), 0x08U};
+static constexpr GpioReg<OSPEEDRBitList, atomicity(BASE_ADDR(GPIO) + 0x08U)> OSPEEDR{BASE_ADDR(GPIO), 0x08U,
+																																											OSPEEDR_RESET_VAL(GPIO)};
 /**@}*/
 
 /**
@@ -100,8 +113,13 @@ static constexpr GpioReg<OSPEEDRBitList, atomicity(BASE_ADDR(GPIO) + 0x08U)> OSP
 SETUP_REGISTER_INFO(GpioPupdInfo, /**/
 										CREATE_LIST_OF_BITS<Bit<2, Pupd>>(detail::IdxRange<0, 30, 2>{}));
 
+constexpr auto PUPDR_RESET_VAL(Port const t_port) noexcept {
+	return ResetVal_t{t_port == Port::PortA ? 0x6400'0000U : (t_port == Port::PortB ? 0x0000'0100U : 0x0U)};
+}
+
 template <Port GPIO>
-static constexpr GpioReg<GpioPupdInfo, atomicity(BASE_ADDR(GPIO) + 0x0CU)> PUPDR{BASE_ADDR(GPIO), 0x0CU};
+static constexpr GpioReg<GpioPupdInfo, atomicity(BASE_ADDR(GPIO) + 0x0CU)> PUPDR{BASE_ADDR(GPIO), 0x0CU,
+																																								 PUPDR_RESET_VAL(GPIO)};
 
 /**@}*/
 
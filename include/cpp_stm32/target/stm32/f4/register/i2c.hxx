@@ -40,6 +40,11 @@ static constexpr auto BASE_ADDR(Port const& t_i2c) {
 	}
 }
 
+/**
+ * @brief	The peripheral registers can only be accessed by half-words or words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word | Access::HalfWord;
+
 /**
  * @defgroup	I2C1_CR1_GROUP		Control register 1 group
  *
@@ -81,7 +86,7 @@ enum class CR1Field {
 };
 
 template <Port I2C>
-static constexpr Register<CR1BitList, CR1Field> CR1{BASE_ADDR(I2C), 0x00U};
+static constexpr Register<CR1BitList, CR1Field, PERIPH_ACCESS> CR1{BASE_ADDR(I2C), 0x00U};
 /**@}*/
 
 /**
@@ -109,7 +114,7 @@ enum class CR2Field {
 };
 
 template <Port I2C>
-static constexpr Register<CR2BitList, CR2Field> CR2{BASE_ADDR(I2C), 0x04U};
+static constexpr Register<CR2BitList, CR2Field, PERIPH_ACCESS> CR2{BASE_ADDR(I2C), 0x04U};
 /**@}*/
 
 /**
@@ -137,7 +142,7 @@ template <SlaveAddressMode AM>
 using AddrMode = typename std::conditional_t<AM == SlaveAddressMode::TenBits, OAR1BitList_10Bit, OAR1BitList_7Bit>;
 
 template <Port I2C, SlaveAddressMode AM>
-static constexpr Register<AddrMode<AM>, OAR1Field> OAR1{BASE_ADDR(I2C), 0x08U};
+static constexpr Register<AddrMode<AM>, OAR1Field, PERIPH_ACCESS> OAR1{BASE_ADDR(I2C), 0x08U};
 
 /**@}*/
 
@@ -158,7 +163,7 @@ enum class OAR2Field {
 };
 
 template <Port I2C>
-static constexpr Register<OAR2BitList, OAR2Field> OAR2{BASE_ADDR(I2C), 0x0cU};
+static constexpr Register<OAR2BitList, OAR2Field, PERIPH_ACCESS> OAR2{BASE_ADDR(I2C), 0x0cU};
 /**@}*/
 
 /**
@@ -176,7 +181,7 @@ enum class DRField {
 };
 
 template <Port I2C>
-static constexpr Register<DRBitList, DRField> DR{BASE_ADDR(I2C), 0x10U};
+static constexpr Register<DRBitList, DRField, PERIPH_ACCESS> DR{BASE_ADDR(I2C), 0x10U};
 /**@}*/
 
 /**
@@ -203,7 +208,7 @@ SETUP_REGISTER_INFO(SR1BitList,									/**/
 )
 
 template <Port I2C>
-static constexpr Register<SR1BitList, InterruptFlag> SR1{BASE_ADDR(I2C), 0x14U};
+static constexpr Register<SR1BitList, InterruptFlag, PERIPH_ACCESS> SR1{BASE_ADDR(I2C), 0x14U};
 /**@}*/
 
 /**
@@ -224,7 +229,7 @@ SETUP_REGISTER_INFO(SR2BitList,							/**/
 )
 
 template <Port I2C>
-static constexpr Register<SR2BitList, Status> SR2{BASE_ADDR(I2C), 0x18U};
+static constexpr Register<SR2BitList, Status, PERIPH_ACCESS> SR2{BASE_ADDR(I2C), 0x18U};
 /**@}*/
 
 /**
@@ -246,7 +251,7 @@ enum class CCRField {
 };
 
 template <Port I2C>
-static constexpr Register<CCRBitList, CCRField> CCR{BASE_ADDR(I2C), 0x1cU};
+static constexpr Register<CCRBitList, CCRField, PERIPH_ACCESS> CCR{BASE_ADDR(I2C), 0x1cU};
 /**@}*/
 
 /**
@@ -264,7 +269,7 @@ enum class TRISEField {
 };
 
 template <Port I2C>
-static constexpr Register<TRISEBitList, TRISEField> TRISE{BASE_ADDR(I2C), 0x20U, ResetVal_t{0x0002U}};
+static constexpr Register<TRISEBitList, TRISEField, PERIPH_ACCESS> TRISE{BASE_ADDR(I2C), 0x20U, ResetVal_t{0x0002U}};
 /**@}*/
 
 /**
@@ -284,7 +289,7 @@ enum class FLTRField {
 };
 
 template <Port I2C>
-static constexpr Register<FLTRBitList, FLTRField> FLTR{BASE_ADDR(I2C), 0x24U};
+static constexpr Register<FLTRBitList, FLTRField, PERIPH_ACCESS> FLTR{BASE_ADDR(I2C), 0x24U};
 /**@}*/
 
 }	 // namespace cpp_stm32::i2c::reg
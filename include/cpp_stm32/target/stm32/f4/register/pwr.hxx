@@ -35,6 +35,11 @@ namespace cpp_stm32::pwr::reg {
 
 static constexpr auto BASE_ADDR = memory_at(PeriphAddr::Apb1Base, 0x7000U);
 
+/**
+ * @brief	The peripheral registers can only be accessed by half-words or words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word | Access::HalfWord;
+
 /**
  * @defgroup  CR_GROUP		Power Control Register Group
  * @{
@@ -53,7 +58,7 @@ enum class CrBit {
 	OdSwEn,
 };
 
-static constexpr Register<PwrCrInfo, CrBit> CR{BASE_ADDR, 0x00U};
+static constexpr Register<PwrCrInfo, CrBit, PERIPH_ACCESS> CR{BASE_ADDR, 0x00U};
 
 /**@}*/
 
@@ -67,7 +72,7 @@ SETUP_REGISTER_INFO(PwrCsrInfo, /**/
 
 enum class CsrBit { VosRdy, OdrRdy, OdrSwRdy };
 
-static constexpr Register<PwrCsrInfo, CsrBit> CSR{BASE_ADDR, 0x04U};
+static constexpr Register<PwrCsrInfo, CsrBit, PERIPH_ACCESS> CSR{BASE_ADDR, 0x04U};
 /**@}*/
 
 }	 // namespace cpp_stm32::pwr::reg
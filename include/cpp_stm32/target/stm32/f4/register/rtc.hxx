@@ -31,6 +31,11 @@ namespace cpp_stm32::rtc::reg {
 
 static constexpr auto BASE_ADDR = 0x40002800U;
 
+/**
+ * @brief	The peripheral registers can only be accessed by words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word;
+
 /**
  * @defgroup	RTC_TR_GROUP		time register group
  *
@@ -57,7 +62,7 @@ enum class TRField {
 	PM,	 /*!< AM/PM notation*/
 };
 
-static constexpr Register<TRBitList, TRField> TR{BASE_ADDR, 0x00U};
+static constexpr Register<TRBitList, TRField, PERIPH_ACCESS> TR{BASE_ADDR, 0x00U};
 /**@}*/
 
 /**
@@ -86,7 +91,7 @@ enum class DRField {
 	YT,	 /*!< Year tens in BCD format*/
 };
 
-static constexpr Register<DRBitList, DRField> DR{BASE_ADDR, 0x04U};
+static constexpr Register<DRBitList, DRField, PERIPH_ACCESS> DR{BASE_ADDR, 0x04U};
 /**@}*/
 
 /**
@@ -141,7 +146,7 @@ enum class CRField {
 	COE,		 /*!< Calibration output enable*/
 };
 
-static constexpr Register<CRBitList, CRField> CR{BASE_ADDR, 0x08U};
+static constexpr Register<CRBitList, CRField, PERIPH_ACCESS> CR{BASE_ADDR, 0x08U};
 /**@}*/
 
 /**
@@ -169,7 +174,7 @@ SETUP_REGISTER_INFO(ISRBitList,									 /**/
 										StatusBit<1>{BitPos_t{0}}		 // ALRAWF
 )
 
-static constexpr Register<ISRBitList, Status> ISR{BASE_ADDR, 0x0cU};
+static constexpr Register<ISRBitList, Status, PERIPH_ACCESS> ISR{BASE_ADDR, 0x0cU};
 /**@}*/
 
 /**
@@ -188,7 +193,7 @@ enum class PRERField {
 	PREDIV_A, /*!< Asynchronous prescaler factor*/
 };
 
-static constexpr Register<PRERBitList, PRERField> PRER{BASE_ADDR, 0x10U};
+static constexpr Register<PRERBitList, PRERField, PERIPH_ACCESS> PRER{BASE_ADDR, 0x10U};
 /**@}*/
 
 /**
@@ -205,7 +210,7 @@ enum class WUTRField {
 	WUT, /*!< Wakeup auto-reload value bits*/
 };
 
-static constexpr Register<WUTRBitList, WUTRField> WUTR{BASE_ADDR, 0x14U};
+static constexpr Register<WUTRBitList, WUTRField, PERIPH_ACCESS> WUTR{BASE_ADDR, 0x14U};
 /**@}*/
 
 /**
@@ -224,7 +229,7 @@ enum class CALIBRField {
 	DCS, /*!< Digital calibration sign*/
 };
 
-static constexpr Register<CALIBRBitList, CALIBRField> CALIBR{BASE_ADDR, 0x18U};
+static constexpr Register<CALIBRBitList, CALIBRField, PERIPH_ACCESS> CALIBR{BASE_ADDR, 0x18U};
 /**@}*/
 
 /**
@@ -267,8 +272,8 @@ enum class ALRMField {
 	MSK4,	 /*!< Alarm A date mask*/
 };
 
-static constexpr Register<ALRMRBitList, ALRMField> ALRMAR{BASE_ADDR, 0x1cU};
-static constexpr Register<ALRMRBitList, ALRMField> ALRMBR{BASE_ADDR, 0x20U};
+static constexpr Register<ALRMRBitList, ALRMField, PERIPH_ACCESS> ALRMAR{BASE_ADDR, 0x1cU};
+static constexpr Register<ALRMRBitList, ALRMField, PERIPH_ACCESS> ALRMBR{BASE_ADDR, 0x20U};
 
 /**@}*/
 
@@ -286,7 +291,7 @@ enum class WPRField {
 	KEY, /*!< Write protection key*/
 };
 
-static constexpr Register<WPRBitList, WPRField> WPR{BASE_ADDR, 0x24U};
+static constexpr Register<WPRBitList, WPRField, PERIPH_ACCESS> WPR{BASE_ADDR, 0x24U};
 /**@}*/
 
 /**
@@ -303,7 +308,7 @@ enum class SSRField {
 	SS, /*!< Sub second value*/
 };
 
-static constexpr Register<SSRBitList, SSRField> SSR{BASE_ADDR, 0x28U};
+static constexpr Register<SSRBitList, SSRField, PERIPH_ACCESS> SSR{BASE_ADDR, 0x28U};
 /**@}*/
 
 /**
@@ -322,7 +327,7 @@ enum class SHIFTRField {
 	ADD1S, /*!< Add one second*/
 };
 
-static constexpr Register<SHIFTRBitList, SHIFTRField> SHIFTR{BASE_ADDR, 0x2cU};
+static constexpr Register<SHIFTRBitList, SHIFTRField, PERIPH_ACCESS> SHIFTR{BASE_ADDR, 0x2cU};
 /**@}*/
 
 /**
@@ -349,7 +354,7 @@ enum class TSTRField {
 	ALARMOUTTYPE, /*!< AFO_ALARM output type*/
 };
 
-static constexpr Register<TSTRBitList, TSTRField> TSTR{BASE_ADDR, 0x30U};
+static constexpr Register<TSTRBitList, TSTRField, PERIPH_ACCESS> TSTR{BASE_ADDR, 0x30U};
 /**@}*/
 
 /**
@@ -374,7 +379,7 @@ enum class TSDRField {
 	WDU, /*!< Week day units*/
 };
 
-static constexpr Register<TSDRBitList, TSDRField> TSDR{BASE_ADDR, 0x34U};
+static constexpr Register<TSDRBitList, TSDRField, PERIPH_ACCESS> TSDR{BASE_ADDR, 0x34U};
 /**@}*/
 
 /**
@@ -391,7 +396,7 @@ enum class TSSSRField {
 	SS, /*!< Sub second value*/
 };
 
-static constexpr Register<TSSSRBitList, TSSSRField> TSSSR{BASE_ADDR, 0x38U};
+static constexpr Register<TSSSRBitList, TSSSRField, PERIPH_ACCESS> TSSSR{BASE_ADDR, 0x38U};
 /**@}*/
 
 /**
@@ -414,7 +419,7 @@ enum class CALRField {
 	CALP,		/*!< Increase frequency of RTC by 488.5 ppm*/
 };
 
-static constexpr Register<CALRBitList, CALRField> CALR{BASE_ADDR, 0x3cU};
+static constexpr Register<CALRBitList, CALRField, PERIPH_ACCESS> CALR{BASE_ADDR, 0x3cU};
 /**@}*/
 
 /**
@@ -455,7 +460,7 @@ enum class TAFCRField {
 	ALARMOUTTYPE, /*!< AFO_ALARM output type*/
 };
 
-static constexpr Register<TAFCRBitList, TAFCRField> TAFCR{BASE_ADDR, 0x40U};
+static constexpr Register<TAFCRBitList, TAFCRField, PERIPH_ACCESS> TAFCR{BASE_ADDR, 0x40U};
 /**@}*/
 
 /**
@@ -474,8 +479,8 @@ enum class ALRMSSRField {
 	MASKSS, /*!< Mask the most-significant bits starting at this bit*/
 };
 
-static constexpr Register<ALRMSSRBitList, ALRMSSRField> ALRMASSR{BASE_ADDR, 0x44U};
-static constexpr Register<ALRMSSRBitList, ALRMSSRField> ALRMBSSR{BASE_ADDR, 0x48U};
+static constexpr Register<ALRMSSRBitList, ALRMSSRField, PERIPH_ACCESS> ALRMASSR{BASE_ADDR, 0x44U};
+static constexpr Register<ALRMSSRBitList, ALRMSSRField, PERIPH_ACCESS> ALRMBSSR{BASE_ADDR, 0x48U};
 /**@}*/
 
 /**
@@ -493,7 +498,7 @@ enum class BKPRField {
 };
 
 template <std::uint8_t Offset>
-static constexpr Register<BKPRBitList, BKPRField> BKPR{BASE_ADDR, 0x50U + Offset * 0x04U};
+static constexpr Register<BKPRBitList, BKPRField, PERIPH_ACCESS> BKPR{BASE_ADDR, 0x50U + Offset * 0x04U};
 /**@}*/
 
 }	 // namespace cpp_stm32::rtc::reg
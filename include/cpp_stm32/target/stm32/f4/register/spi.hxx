@@ -42,6 +42,11 @@ static constexpr auto BASE_ADDR(Port const& t_spi) {
 	}
 }
 
+/**
+ * @brief	The peripheral registers can only be accessed by half-words or words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word | Access::HalfWord;
+
 /**
  * @defgroup	SPI4_CR1_GROUP		control register 1 group
  *
@@ -82,8 +87,13 @@ enum class CR1Field {
 	BIDIMODE, /*!< Bidirectional data mode enable*/
 };
 
+/**
+ * @note 	CRCNEXT is cleared by hardware after CRC transfer. MSTR and SPE are cleared by hardware on mode fault as
+ * 				well, call sync() after mode fault (SR.MODF) is detected.
+ */
 template <Port SPI>
-static constexpr Register<CR1BitList, CR1Field> CR1{BASE_ADDR(SPI), 0x00U};
+inline constexpr CachedRegister<CR1BitList, CR1Field, PERIPH_ACCESS, HwModified<>, SelfClearing<CR1Field::CRCNEXT>> CR1{
+	BASE_ADDR(SPI), 0x00U};
 /**@}*/
 
 /**
@@ -113,7 +123,7 @@ enum class CR2Field {
 };
 
 template <Port SPI>
-static constexpr Register<CR2BitList, CR2Field> CR2{BASE_ADDR(SPI), 0x04U};
+static constexpr Register<CR2BitList, CR2Field, PERIPH_ACCESS> CR2{BASE_ADDR(SPI), 0x04U};
 /**@}*/
 
 /**
@@ -135,7 +145,7 @@ SETUP_REGISTER_INFO(SRBitList,									/**/
 )
 
 template <Port SPI>
-static constexpr Register<SRBitList, Status> SR{BASE_ADDR(SPI), 0x08U};
+static constexpr Register<SRBitList, Status, PERIPH_ACCESS> SR{BASE_ADDR(SPI), 0x08U};
 /**@}*/
 
 /**
@@ -153,7 +163,7 @@ enum class DRField {
 };
 
 template <Port SPI>
-static constexpr Register<DRBitList, DRField> DR{BASE_ADDR(SPI), 0x0cU};
+static constexpr Register<DRBitList, DRField, PERIPH_ACCESS> DR{BASE_ADDR(SPI), 0x0cU};
 /**@}*/
 
 /**
@@ -171,7 +181,7 @@ enum class CRCPRField {
 };
 
 template <Port SPI>
-static constexpr Register<CRCPRBitList, CRCPRField> CRCPR{BASE_ADDR(SPI), 0x10U};
+static constexpr Register<CRCPRBitList, CRCPRField, PERIPH_ACCESS> CRCPR{BASE_ADDR(SPI), 0x10U};
 /**@}*/
 
 /**
@@ -189,7 +199,7 @@ enum class RXCRCRField {
 };
 
 template <Port SPI>
-static constexpr Register<RXCRCRBitList, RXCRCRField> RXCRCR{BASE_ADDR(SPI), 0x14U};
+static constexpr Register<RXCRCRBitList, RXCRCRField, PERIPH_ACCESS> RXCRCR{BASE_ADDR(SPI), 0x14U};
 /**@}*/
 
 /**
@@ -207,7 +217,7 @@ enum class TXCRCRField {
 };
 
 template <Port SPI>
-static constexpr Register<TXCRCRBitList, TXCRCRField> TXCRCR{BASE_ADDR(SPI), 0x18U};
+static constexpr Register<TXCRCRBitList, TXCRCRField, PERIPH_ACCESS> TXCRCR{BASE_ADDR(SPI), 0x18U};
 /**@}*/
 
 /**
@@ -239,7 +249,7 @@ enum class I2SCFGRField {
 };
 
 template <Port SPI>
-static constexpr Register<I2SCFGRBitList, I2SCFGRField> I2SCFGR{BASE_ADDR(SPI), 0x1cU};
+static constexpr Register<I2SCFGRBitList, I2SCFGRField, PERIPH_ACCESS> I2SCFGR{BASE_ADDR(SPI), 0x1cU};
 /**@}*/
 
 /**
@@ -261,7 +271,7 @@ enum class I2SPRField {
 };
 
 template <Port SPI>
-static constexpr Register<I2SPRBitList, I2SPRField> I2SPR{BASE_ADDR(SPI), 0x20U};
+static constexpr Register<I2SPRBitList, I2SPRField, PERIPH_ACCESS> I2SPR{BASE_ADDR(SPI), 0x20U};
 /**@}*/
 
 }	 // namespace cpp_stm32::spi::reg
@@ -32,6 +32,11 @@ namespace cpp_stm32::syscfg::reg {
 
 static constexpr auto BASE_ADDR = 0x40013800U;
 
+/**
+ * @brief	The peripheral registers can only be accessed by words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word;
+
 static constexpr auto OFFSET(gpio::Pin const t_exticr) {
 	switch (to_underlying(t_exticr) / 4) {
 		case 0:
@@ -67,7 +72,7 @@ enum class MEMRMField {
 	MEM_MODE, /*!< Memory mapping selection*/
 };
 
-static constexpr Register<MEMRMBitList, MEMRMField> MEMRM{BASE_ADDR, 0x00U};
+static constexpr Register<MEMRMBitList, MEMRMField, PERIPH_ACCESS> MEMRM{BASE_ADDR, 0x00U};
 /**@}*/
 
 /**
@@ -90,7 +95,7 @@ enum class PMCField {
 	MII_RMII_SEL, /*!< Ethernet PHY interface selection*/
 };
 
-static constexpr Register<PMCBitList, PMCField> PMC{BASE_ADDR, 0x04U};
+static constexpr Register<PMCBitList, PMCField, PERIPH_ACCESS> PMC{BASE_ADDR, 0x04U};
 /**@}*/
 
 /**
@@ -102,7 +107,7 @@ static constexpr Register<PMCBitList, PMCField> PMC{BASE_ADDR, 0x04U};
 SETUP_REGISTER_INFO(EXTICRxBitList, CREATE_LIST_OF_BITS<Bit<4, gpio::Port>>(detail::IdxRange<0, 12, 4>{}))
 
 template <gpio::Pin CR>
-static constexpr Register<EXTICRxBitList, gpio::Pin, DEFAULT_ACCESS, true, ExtiCRxIdxPolicy> EXTICRx{BASE_ADDR,
+static constexpr Register<EXTICRxBitList, gpio::Pin, PERIPH_ACCESS, true, ExtiCRxIdxPolicy> EXTICRx{BASE_ADDR,
 																																																		 OFFSET(CR)};
 /**@}*/
 
@@ -122,7 +127,7 @@ enum class CMPCRField {
 	READY,	/*!< READY*/
 };
 
-static constexpr Register<CMPCRBitList, CMPCRField> CMPCR{BASE_ADDR, 0x20U};
+static constexpr Register<CMPCRBitList, CMPCRField, PERIPH_ACCESS> CMPCR{BASE_ADDR, 0x20U};
 /**@}*/
 
 }	 // namespace cpp_stm32::syscfg::reg
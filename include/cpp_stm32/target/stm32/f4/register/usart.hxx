@@ -24,6 +24,7 @@
 
 #include "cpp_stm32/hal/bit.hxx"
 #include "cpp_stm32/hal/register.hxx"
+#include "cpp_stm32/processor/cortex_m4/bit_banding.hxx"
 
 #include "cpp_stm32/target/stm32/f4/define/usart.hxx"
 #include "cpp_stm32/target/stm32/f4/register/memory_map.hxx"
@@ -47,6 +48,11 @@ static constexpr auto BASE_ADDR(Port const t_usart_num) {
 	}
 }
 
+/**
+ * @brief	The peripheral registers can only be accessed by half-words or words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word | Access::HalfWord;
+
 /**
  * @defgroup SR_GROUP		USART Status Register Group
  * @{
@@ -60,7 +66,7 @@ SETUP_REGISTER_INFO(UsartSrInfo, /**/
 // enum class SrBit { PE, FE, NF, OrE, Idle, RxNE, TC, TxE, LBD, CTS };
 
 template <Port InputPort>
-static constexpr Register<UsartSrInfo, InterruptFlag> SR{BASE_ADDR(InputPort), 0x00U};
+static constexpr Register<UsartSrInfo, InterruptFlag, PERIPH_ACCESS> SR{BASE_ADDR(InputPort), 0x00U};
 /**@}*/
 
 /**
@@ -104,7 +110,8 @@ SETUP_REGISTER_INFO(UsartCr1Info, /**/
 enum class Cr1Bit { SBk, RWu, RE, TE, IdleIE, RxNEIE, TCIE, TxEIE, PEIE, PS, PCE, Wake, M, UE, Over8 };
 
 template <Port InputPort>
-static constexpr Register<UsartCr1Info, Cr1Bit> CR1{BASE_ADDR(InputPort), 0x0CU};
+static constexpr Register<UsartCr1Info, Cr1Bit, PERIPH_ACCESS, atomicity(BASE_ADDR(InputPort) + 0x0CU)> CR1{
+	BASE_ADDR(InputPort), 0x0CU};
 
 /**@}*/
 
@@ -121,7 +128,7 @@ SETUP_REGISTER_INFO(UsartCr2Info, /**/
 enum class Cr2Bit { Add, LBDL, LBDIE, LbCl, CPha, CPol, ClkEn, Stop, LINEn };
 
 template <Port InputPort>
-static constexpr Register<UsartCr2Info, Cr2Bit> CR2{BASE_ADDR(InputPort), 0x10U};
+static constexpr Register<UsartCr2Info, Cr2Bit, PERIPH_ACCESS> CR2{BASE_ADDR(InputPort), 0x10U};
 /**@}*/
 
 /**
@@ -137,7 +144,8 @@ SETUP_REGISTER_INFO(UsartCr3Info, /**/
 enum class Cr3Bit { EIE, IrEn, IrLP, HDSel, NAck, SCEN, DMAR, DMAT, RTSE, CTSE, CTSIE, OneBit };
 
 template <Port InputPort>
-static constexpr Register<UsartCr3Info, Cr3Bit> CR3{BASE_ADDR(InputPort), 0x14U};
+static constexpr Register<UsartCr3Info, Cr3Bit, PERIPH_ACCESS, atomicity(BASE_ADDR(InputPort) + 0x14U)> CR3{
+	BASE_ADDR(InputPort), 0x14U};
 
 /**@}*/
 
@@ -152,7 +160,7 @@ SETUP_REGISTER_INFO(UsartGtprInfo, /**/
 enum class GtprBit { Psc, GT };
 
 template <Port InputPort>
-static constexpr Register<UsartGtprInfo, GtprBit> GTPR{BASE_ADDR(InputPort), 0x18U};
+static constexpr Register<UsartGtprInfo, GtprBit, PERIPH_ACCESS> GTPR{BASE_ADDR(InputPort), 0x18U};
 
 /**@}*/
 
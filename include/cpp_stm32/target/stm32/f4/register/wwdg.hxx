@@ -9,6 +9,11 @@ namespace cpp_stm32::wwdg::reg {
 
 static constexpr auto BASE_ADDR = 0x40002c00U;
 
+/**
+ * @brief	The peripheral registers can only be accessed by half-words or words
+ */
+static constexpr auto PERIPH_ACCESS = Access::Word | Access::HalfWord;
+
 /**
  * @defgroup	WWDG_CR_GROUP		Control register group
  *
@@ -25,7 +30,7 @@ enum class CRField {
 	WDGA, /*!< Activation bit*/
 };
 
-static constexpr Register<CRBitList, CRField> CR{BASE_ADDR, 0x00U};
+static constexpr Register<CRBitList, CRField, PERIPH_ACCESS> CR{BASE_ADDR, 0x00U};
 /**@}*/
 
 /**
@@ -46,7 +51,7 @@ enum class CFRField {
 	EWI,	 /*!< Early wakeup interrupt*/
 };
 
-static constexpr Register<CFRBitList, CFRField> CFR{BASE_ADDR, 0x04U};
+static constexpr Register<CFRBitList, CFRField, PERIPH_ACCESS> CFR{BASE_ADDR, 0x04U};
 /**@}*/
 
 /**
@@ -63,7 +68,7 @@ enum class SRField {
 	EWIF, /*!< Early wakeup interrupt flag*/
 };
 
-static constexpr Register<SRBitList, SRField> SR{BASE_ADDR, 0x08U};
+static constexpr Register<SRBitList, SRField, PERIPH_ACCESS> SR{BASE_ADDR, 0x08U};
 /**@}*/
 
 }	 // namespace cpp_stm32::wwdg::reg
@@ -24,9 +24,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <tuple>
 #include <type_traits>
 
+#include "cpp_stm32/utility/span.hxx"
+
 #include "cpp_stm32/target/stm32/f4/define/spi.hxx"
 #include "cpp_stm32/target/stm32/f4/register/spi.hxx"
 
@@ -235,12 +239,13 @@ constexpr void set_baudrate_prescaler(Baudrate_t const t_spi_baud) noexcept {
 }
 
 /**
- * @brief 	This function select closest SPI baudrate prescaler
+ * @brief 	This function calculates closest SPI baudrate prescaler
  * @tparam 	SPI 	@ref spi::Port
  * @tparam 	HZ 		Desire frequency of SPI SCLK
+ * @return 	@ref spi::Baudrate_t
  */
 template <Port SPI, std::uint32_t HZ>
-constexpr void set_baudrate(Frequency<HZ> const /**/) noexcept {
+[[nodiscard]] constexpr auto calc_baudrate_prescaler(Frequency<HZ> const /**/) noexcept {
 	constexpr auto division = []() {
 		if constexpr (SPI == Port::SPI1 || SPI == Port::SPI4) {
 			return APB2_FREQ / HZ;
@@ -251,7 +256,17 @@ constexpr void set_baudrate(Frequency<HZ> const /**/) noexcept {
 	constexpr auto up_bound = Baudrate_t::UPPER_BOUND<division>().key;
 
 	// @todo: need to consider limit
-	set_baudrate_prescaler<SPI>(Baudrate_t{uint32_c<up_bound>{}});
+	return Baudrate_t{uint32_c<up_bound>{}};
+}
+
+/**
+ * @brief 	This function select closest SPI baudrate prescaler
+ * @tparam 	SPI 	@ref spi::Port
+ * @tparam 	HZ 		Desire frequency of SPI SCLK
+ */
+template <Port SPI, std::uint32_t HZ>
+constexpr void set_baudrate(Frequency<HZ> const t_freq) noexcept {
+	set_baudrate_prescaler<SPI>(calc_baudrate_prescaler<SPI>(t_freq));
 }
 
 /**
@@ -342,10 +357,10 @@ constexpr void send_blocking(IterT const t_begin, IterT const t_end) noexcept {
 template <Port SPI, typename DataType, std::uint8_t N>
 constexpr auto receive_blocking(DataCount<DataType, N> const /*unused*/) noexcept {
 	static_assert(std::is_same_v<DataType, std::uint8_t> || std::is_same_v<DataType, std::uint16_t>);
-	std::array<std::uint16_t, N> ret_val{};
+	std::array<DataType, N> ret_val{};
 	std::generate(ret_val.begin(), ret_val.end(), []() {
 		wait_status<SPI, Status::RXNE>(true);
-		return reg::DR<SPI>.template readBit<reg::DRField::DR>(ValWithPos);
+		return static_cast<DataType>(std::get<0>(reg::DR<SPI>.template readBit<reg::DRField::DR>(ValueOnly)));
 	});
 
 	return ret_val;
@@ -354,6 +369,9 @@ constexpr auto receive_blocking(DataCount<DataType, N> const /*unused*/) noexcep
 /**
  * @brief   This function send and receive data from slave
  * @param   t_bc    Byte to receive
+ *
+ * @note    Data is received after the whole tx buffer is sent, the frames received meanwhile are lost, use
+ *          @ref xfer_full_duplex to receive every frame
  * @param   t_begin Begin of the tx buffer
  * @param   t_end   End of the tx buffer
  */
@@ -364,6 +382,59 @@ constexpr auto xfer_blocking(DataCount<typename std::iterator_traits<IterT>::val
 	return receive_blocking<SPI>(t_bc);
 }
 
+/**
+ * @brief   This function transmits and receives at the same time, frame by frame. Next frame is written as soon as TX
+ *          buffer is empty, i.e. while the current one is being shifted out, and the received frame is read before
+ *          the next one completes, so SCLK runs back to back with one frame in flight, and no frame is lost.
+ * @tparam  SPI       @ref spi::Port
+ * @tparam  DataType  std::uint8_t or std::uint16_t, must match @ref spi::DataFrameFormat
+ * @param   t_tx      Data to transmit, 0 is sent after it runs out
+ * @param   t_rx      Buffer of received data, frames that don't fit are dropped
+ *
+ * @note    max(t_tx.size(), t_rx.size()) frames are transferred. Interrupt longer than one frame time between TXE and
+ *          RXNE stalls the bus (and overruns at high SCLK), keep it short or use DMA.
+ */
+template <Port SPI, typename DataType>
+void xfer_full_duplex(Span<std::common_type_t<DataType> const> const t_tx, Span<DataType> const t_rx) noexcept {
+	static_assert(std::is_same_v<DataType, std::uint8_t> || std::is_same_v<DataType, std::uint16_t>);
+
+	auto const count = std::max(t_tx.size(), t_rx.size());
+	if (count == 0) {
+		return;
+	}
+
+	auto const write_frame = [t_tx](std::size_t const t_idx) {
+		std::uint16_t const val = t_idx < t_tx.size() ? t_tx[t_idx] : DataType{0};
+		reg::DR<SPI>.template writeBit<reg::DRField::DR>(val);
+	};
+
+	auto const read_frame = [t_rx](std::size_t const t_idx) {
+		auto const [val] = reg::DR<SPI>.template readBit<reg::DRField::DR>(ValueOnly);
+		if (t_idx < t_rx.size()) {
+			t_rx[t_idx] = static_cast<DataType>(val);
+		}
+	};
+
+	// stale frame left by send_blocking would shift the received data by one
+	if (std::get<0>(get_status<SPI, Status::RXNE>())) {
+		std::ignore = reg::DR<SPI>.template readBit<reg::DRField::DR>(ValueOnly);
+	}
+
+	wait_status<SPI, Status::TXE>(true);
+	write_frame(0);
+
+	for (std::size_t i = 1; i < count; ++i) {
+		wait_status<SPI, Status::TXE>(true);
+		write_frame(i);
+
+		wait_status<SPI, Status::RXNE>(true);
+		read_frame(i - 1);
+	}
+
+	wait_status<SPI, Status::RXNE>(true);
+	read_frame(count - 1);
+}
+
 /**
  * @brief   This function enables interrupt
  * @tparam  SPI   @ref spi::Port
@@ -429,13 +500,17 @@ constexpr void init_master(Mode const t_mode, size_c<Ds> const, Frequency<Hz> co
 	constexpr std::uint8_t lsb_first		= 0;	// msb first
 	constexpr std::uint8_t frame_format = 0;	// motorola
 
-	CR1<SPI>.template writeBit<CR1Field::MSTR, CR1Field::BIDIMODE, CR1Field::BIDIOE, CR1Field::RXONLY, //
-	 													 CR1Field::SSM, CR1Field::CPHA, CR1Field::CPOL, CR1Field::LSBFIRST, CR1Field::DFF>(
-		master, bidimode_val, bidioe_val, rxonly_val, ssm_val, second_edge_capture, idle_high, lsb_first, data_frame);
+	// configuration and baudrate are written in one store, SPE is set afterwards as required by reference manual
+	CR1<SPI>
+		.modify()
+		.template writeBit<CR1Field::MSTR, CR1Field::BIDIMODE, CR1Field::BIDIOE, CR1Field::RXONLY, //
+											 CR1Field::SSM, CR1Field::CPHA, CR1Field::CPOL, CR1Field::LSBFIRST, CR1Field::DFF>(
+			master, bidimode_val, bidioe_val, rxonly_val, ssm_val, second_edge_capture, idle_high, lsb_first, data_frame)
+		.template writeBit<CR1Field::BR>(calc_baudrate_prescaler<SPI>(t_baud))
+		.apply();
 
 	CR2<SPI>.template writeBit<CR2Field::SSOE, CR2Field::FRF>(ssoe_val, frame_format);
 
-	set_baudrate<SPI>(t_baud);
 	enable<SPI>();
 }
 
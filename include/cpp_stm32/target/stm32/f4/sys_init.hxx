@@ -27,6 +27,7 @@
 
 #include "cpp_stm32/detail/algorithm.hxx"
 #include "cpp_stm32/detail/tuple.hxx"
+#include "cpp_stm32/hal/init_table.hxx"
 #include "cpp_stm32/target/stm32/f4/clock.hxx"
 #include "cpp_stm32/target/stm32/f4/flash.hxx"
 #include "cpp_stm32/target/stm32/f4/pwr.hxx"
@@ -227,6 +228,87 @@ class Clock {
 											PllRChecker{DivisionFactor_v<pllr>}};
 	}
 
+	/**
+	 * @brief  This function builds the records of @ref init, step by step, see @ref INIT_TABLE
+	 * @note 	 Any change to @ref init must be made here too, test/host/clock_init_table.cpp checks that both write the same
+	 * 				 values to the same registers in the same order
+	 */
+	static constexpr auto BUILD_INIT_TABLE() noexcept {
+		using rcc::ClkRegMap, rcc::ClkSrc, rcc::PeriphClk, rcc::SysClk;
+
+		constexpr auto bypass_hse = []() {
+			if constexpr (CLOCK_DATA.bypassHSE) {
+				constexpr auto bypass = ClkRegMap::template getExtBypassReg<ClkSrc::Hse>();
+				return init::write(std::get<0>(bypass).modify().template setBit<std::get<1>(bypass)>());
+			} else {
+				return init::Table<0>{};
+			}
+		}();
+
+		constexpr auto setup_pll = []() {
+			if constexpr (CLOCK_DATA.srcPLL.has_value()) {
+				constexpr auto pll_src = CLOCK_DATA.srcPLL.value();
+				constexpr auto src_on	 = ClkRegMap::template getOscOnReg<pll_src>();
+				constexpr auto src_rdy = ClkRegMap::template getOscRdyReg<pll_src>();
+				constexpr auto pll_on	 = ClkRegMap::template getOscOnReg<ClkSrc::Pll>();
+				constexpr auto pwr_en	 = ClkRegMap::template getPeriphEnReg<PeriphClk::Pwr>();
+				constexpr auto div		 = GET_PLL_DIV_FACTOR<pll_src>();
+
+				using rcc::reg::PllCfgBit;
+				return init::make_table(
+					init::write(std::get<0>(src_on).modify().template setBit<std::get<1>(src_on)>()),
+					init::wait_until<std::get<1>(src_rdy)>(std::get<0>(src_rdy)),
+					init::write(rcc::reg::CFGR.modify().writeBit<rcc::reg::CfgBit::SW>(SysClk{to_underlying(pll_src)})),
+					init::write(std::get<0>(pll_on).modify().template clearBit<std::get<1>(pll_on)>()),
+					init::write(rcc::reg::PLLCFGR.modify()
+												.writeBit<PllCfgBit::PLLSRC, PllCfgBit::PLLM, PllCfgBit::PLLN, PllCfgBit::PLLP, PllCfgBit::PLLQ,
+																	PllCfgBit::PLLR>(pll_src, std::get<0>(div)(), std::get<1>(div)(), std::get<2>(div)(),
+																									 std::get<3>(div)(), std::get<4>(div)())),
+					init::write(std::get<0>(pwr_en).modify().template setBit<std::get<1>(pwr_en)>()),
+					init::write(pwr::reg::CR.modify().writeBit<pwr::reg::CrBit::Vos>(VOLTAGE_SCALE)),
+					init::write(std::get<0>(pll_on).modify().template setBit<std::get<1>(pll_on)>()));
+			} else {
+				return init::Table<0>{};
+			}
+		}();
+
+		constexpr auto overdrive = []() {
+			if constexpr (NEED_OVERDRIVE) {
+				using pwr::reg::CrBit, pwr::reg::CsrBit;
+				return init::make_table(init::write(pwr::reg::CR.modify().setBit<CrBit::OdEn>()),
+																init::wait_until<CsrBit::OdrRdy>(pwr::reg::CSR),
+																init::write(pwr::reg::CR.modify().setBit<CrBit::OdSwEn>()),
+																init::wait_until<CsrBit::OdrSwRdy>(pwr::reg::CSR));
+			} else {
+				return init::Table<0>{};
+			}
+		}();
+
+		constexpr auto pll_lock = []() {
+			if constexpr (CLOCK_DATA.srcPLL.has_value()) {
+				constexpr auto pll_rdy = ClkRegMap::template getOscRdyReg<ClkSrc::Pll>();
+				return init::wait_until<std::get<1>(pll_rdy)>(std::get<0>(pll_rdy));
+			} else {
+				return init::Table<0>{};
+			}
+		}();
+
+		constexpr auto wait_state = flash::Latency{flash::CpuWaitState_v<CPU_WAIT_STATE>};
+		constexpr auto bus_div		= GET_ADVANCE_BUS_DIV_FACTOR();
+		constexpr auto ahb				= std::get<0>(bus_div)();
+		constexpr auto apb1				= std::get<1>(bus_div)();
+		constexpr auto apb2				= std::get<2>(bus_div)();
+		using flash::reg::AcrBit, rcc::reg::CfgBit;
+
+		return init::make_table(
+			bypass_hse, setup_pll, overdrive,
+			init::write(flash::reg::ACR.modify().writeBit<AcrBit::Latency, AcrBit::ICEn, AcrBit::DCEn>(
+				wait_state, std::uint8_t{1}, std::uint8_t{1})),
+			init::write(rcc::reg::CFGR.modify().writeBit<CfgBit::HPRE, CfgBit::PPRE1, CfgBit::PPRE2>(ahb, apb1, apb2)),
+			pll_lock, init::write(rcc::reg::CFGR.modify().writeBit<CfgBit::SW>(SYS_CLK_SRC)),
+			init::wait_until<CfgBit::SWS>(rcc::reg::CFGR, SYS_CLK_SRC));
+	}
+
 	// @todo implementation
 	constexpr auto check_sys_src_valid() noexcept {
 		if constexpr (CLOCK_DATA.srcSYS.has_value()) {
@@ -320,6 +402,20 @@ class Clock {
 		rcc::set_sysclk<SYS_CLK_SRC>();
 		rcc::wait_sysclk_rdy<SYS_CLK_SRC>();
 	}
+
+	/**
+	 * @brief  Register accesses of @ref init, i.e. (address, mask, value, op) records computed at compile time
+	 */
+	static constexpr auto INIT_TABLE = BUILD_INIT_TABLE();
+
+	/**
+	 * @brief  This function does the same thing as @ref init, but replays @ref INIT_TABLE instead of inlining every
+	 * 				 register access, which is smaller if other peripherals are initialized by table as well, see hal/init_table.hxx
+	 */
+	static void init_from_table() noexcept {
+		static_assert(IS_CLOCK_DATA_VALID());
+		init::run(INIT_TABLE);
+	}
 };
 
 }	 // namespace cpp_stm32::sys
@@ -24,26 +24,113 @@
 
 #include "cpp_stm32/common/usart.hxx"
 #include "cpp_stm32/target/stm32/f4/register/usart.hxx"
+#include "cpp_stm32/utility/unit.hxx"
 
 #include "project_config.hxx"
 
 namespace cpp_stm32::usart {
 
 /**
- * @brief	 This function sets the baudrate of USART
+ * @brief		Clock frequency of USART, i.e. frequency of the APB it is on
+ */
+template <Port InputPort>
+static constexpr std::uint64_t USART_CLK_FREQ = (InputPort == Port::Usart1 || InputPort == Port::Usart6) ? APB2_FREQ
+																																																			: APB1_FREQ;
+
+/**
+ * @brief		Default tolerance of baudrate error, receiver tolerates about 3 ~ 4 % deviation in total, most of which is left
+ * 					for the clock of the other side
+ */
+static constexpr std::uint32_t BAUDRATE_TOLERANCE_PPM = 10'000;
+
+/**
+ * @struct 	BaudrateConfig
+ * @brief		Oversampling and BRR value of a baudrate, see @ref calc_baudrate_config
+ */
+struct BaudrateConfig {
+	bool valid;
+	OverSampling over_sampling;
+	std::uint16_t mantissa;
+	std::uint8_t fraction;
+	std::uint32_t error_ppm; /*!< Relative error of actual baudrate, in ppm */
+};
+
+/**
+ * @brief		This function calculates oversampling and BRR value closest to the baudrate
+ * @param 	t_clk 	USART clock frequency
+ * @param 	t_baud 	Desired baudrate
+ * @return	@ref BaudrateConfig, not valid if baudrate is higher than t_clk / 8, or too low to be reached
+ *
+ * @note 		Baudrate is t_clk / (8 * mantissa + fraction) for 8x oversampling, t_clk / (16 * mantissa + fraction) for 16x,
+ * 					i.e. both have the resolution of one clock cycle per bit. 16x is chosen whenever possible for its better
+ * 					noise and clock deviation tolerance, 8x is used only if there are less than 16 cycles per bit.
+ */
+constexpr BaudrateConfig calc_baudrate_config(std::uint64_t const t_clk, std::uint64_t const t_baud) noexcept {
+	constexpr std::uint64_t MAX_MANTISSA = 0xFFFU;
+
+	if (t_baud == 0) {
+		return BaudrateConfig{false, OverSampling::OverSampling16, 0, 0, 0};
+	}
+
+	auto const cycle_per_bit = (t_clk + t_baud / 2) / t_baud;	// round (avoiding floating point arithmetic)
+	bool const over8				 = cycle_per_bit < 16;
+	auto const frac_bit			 = over8 ? 3U : 4U;
+	auto const mantissa			 = cycle_per_bit >> frac_bit;
+
+	auto const actual_clk = cycle_per_bit * t_baud;
+	auto const diff				= actual_clk > t_clk ? actual_clk - t_clk : t_clk - actual_clk;
+
+	return BaudrateConfig{
+		0 < mantissa && mantissa <= MAX_MANTISSA,
+		over8 ? OverSampling::OverSampling8 : OverSampling::OverSampling16,
+		static_cast<std::uint16_t>(mantissa & MAX_MANTISSA),
+		static_cast<std::uint8_t>(cycle_per_bit & ((1U << frac_bit) - 1U)),
+		actual_clk == 0 ? 0U : static_cast<std::uint32_t>(diff * 1'000'000U / actual_clk),
+	};
+}
+
+/**
+ * @brief		This function writes oversampling mode and BRR, USART must be disabled
+ * @tparam	InputPort	@ref usart::Port
+ */
+template <Port InputPort>
+constexpr void write_baudrate_config(BaudrateConfig const& t_config) noexcept {
+	reg::CR1<InputPort>.template writeBit<reg::Cr1Bit::Over8>(t_config.over_sampling);
+	reg::BRR<InputPort>.template writeBit<reg::BrrBit::DivFraction, reg::BrrBit::DivMantissa>(t_config.fraction,
+																																												 t_config.mantissa);
+}
+
+/**
+ * @brief	 This function sets the baudrate of USART, for baudrate that is only known at runtime
  * @tparam InputPort	@ref usart::Port
  * @param  t_baud 		@ref usart::Baudrate_t
+ * @return false if the baudrate can't be reached, in which case nothing is changed
  */
 template <Port InputPort>
-constexpr void set_baudrate(Baudrate_t const t_baud) noexcept {
-	constexpr auto clk_freq = (InputPort == Port::Usart1 || InputPort == Port::Usart6 ? APB2_FREQ : APB1_FREQ);
+constexpr bool set_baudrate(Baudrate_t const t_baud) noexcept {
+	auto const config = calc_baudrate_config(USART_CLK_FREQ<InputPort>, t_baud.get());
+
+	if (config.valid) {
+		write_baudrate_config<InputPort>(config);
+	}
 
-	auto const usart_div = (clk_freq + t_baud.get() / 2) / t_baud.get();	// round (avoiding floating point arithmetic)
+	return config.valid;
+}
+
+/**
+ * @brief	 This function sets the baudrate of USART, the configuration is calculated and checked at compile time
+ * @tparam InputPort			@ref usart::Port
+ * @tparam Baud 					Baudrate, e.g. 5_MHz for 5 Mbit/s
+ * @tparam TolerancePpm 	Max error of baudrate, see @ref BAUDRATE_TOLERANCE_PPM
+ */
+template <Port InputPort, std::uint32_t Baud, std::uint32_t TolerancePpm = BAUDRATE_TOLERANCE_PPM>
+constexpr void set_baudrate(Frequency<Baud> const /*unused*/) noexcept {
+	constexpr auto CONFIG = calc_baudrate_config(USART_CLK_FREQ<InputPort>, Baud);
 
-	std::uint16_t const mantissa = usart_div >> 4;
-	std::uint8_t const fraction	= usart_div & 0xF;
+	static_assert(CONFIG.valid, "Baudrate is out of range, it must be between clock / 65535 and clock / 8");
+	static_assert(CONFIG.error_ppm <= TolerancePpm, "Baudrate error exceeds tolerance, adjust clock or baudrate");
 
-	reg::BRR<InputPort>.template writeBit<reg::BrrBit::DivFraction, reg::BrrBit::DivMantissa>(fraction, mantissa);
+	write_baudrate_config<InputPort>(CONFIG);
 }
 
 /**
@@ -223,6 +310,30 @@ constexpr void set_dps(DataBit const t_d, Parity const t_p, StopBit_t<Stop> cons
 	reg::CR2<InputPort>.template writeBit<reg::Cr2Bit::Stop>(Stop);
 }
 
+/**
+ * @brief 	This function returns the CR1 interrupt enable bit of interrupt flag
+ * @tparam 	Flag	@ref usart::InterruptFlag, one that is enabled by CR1
+ */
+template <InterruptFlag Flag>
+constexpr auto irq_enable_bit() noexcept {
+	if constexpr (Flag == InterruptFlag::PE) {
+		return reg::Cr1Bit::PEIE;
+	} else if constexpr (Flag == InterruptFlag::IDLE) {
+		return reg::Cr1Bit::IdleIE;
+	} else if constexpr (Flag == InterruptFlag::RXNE) {
+		return reg::Cr1Bit::RxNEIE;
+	} else if constexpr (Flag == InterruptFlag::TC) {
+		return reg::Cr1Bit::TCIE;
+	} else {
+		static_assert(Flag == InterruptFlag::TXE);
+		return reg::Cr1Bit::TxEIE;
+	}
+}
+
+// FE, NF and ORE are enabled by the same EIE bit
+template <InterruptFlag Flag>
+constexpr bool is_error_irq = Flag == InterruptFlag::FE || Flag == InterruptFlag::ORE || Flag == InterruptFlag::NF;
+
 /**
  * @brief 	This function enables USART interrupt
  * @tparam	InputPort  		@ref usart::Port
@@ -230,18 +341,32 @@ constexpr void set_dps(DataBit const t_d, Parity const t_p, StopBit_t<Stop> cons
  */
 template <Port InputPort, InterruptFlag Flag>
 constexpr void enable_irq() noexcept {
-	constexpr auto is_error_irq = []() {
-		return Flag == InterruptFlag::FE || Flag == InterruptFlag::ORE || Flag == InterruptFlag::NF;
-	};
-
 	if constexpr (Flag == InterruptFlag::CTS) {
 		reg::CR3<InputPort>.template setBit<reg::Cr3Bit::CTSIE>();
 	} else if constexpr (Flag == InterruptFlag::LBD) {
 		reg::CR2<InputPort>.template setBit<reg::Cr2Bit::LBDIE>();
-	} else if constexpr (is_error_irq()) {
+	} else if constexpr (is_error_irq<Flag>) {
 		reg::CR3<InputPort>.template setBit<reg::Cr3Bit::EIE>();
 	} else {
-		reg::CR1<InputPort>.template setBit<reg::Cr1Bit{Flag}>();
+		reg::CR1<InputPort>.template setBit<irq_enable_bit<Flag>()>();
+	}
+}
+
+/**
+ * @brief 	This function disables USART interrupt
+ * @tparam	InputPort  		@ref usart::Port
+ * @tparam 	InterruptFlag	@ref usart::InterruptFlag
+ */
+template <Port InputPort, InterruptFlag Flag>
+constexpr void disable_irq() noexcept {
+	if constexpr (Flag == InterruptFlag::CTS) {
+		reg::CR3<InputPort>.template clearBit<reg::Cr3Bit::CTSIE>();
+	} else if constexpr (Flag == InterruptFlag::LBD) {
+		reg::CR2<InputPort>.template clearBit<reg::Cr2Bit::LBDIE>();
+	} else if constexpr (is_error_irq<Flag>) {
+		reg::CR3<InputPort>.template clearBit<reg::Cr3Bit::EIE>();
+	} else {
+		reg::CR1<InputPort>.template clearBit<irq_enable_bit<Flag>()>();
 	}
 }
 
@@ -277,6 +402,20 @@ constexpr auto enable_idle_irq = enable_irq<InputPort, InterruptFlag::IDLE>;
 template <Port InputPort>
 constexpr auto enable_txe_irq = enable_irq<InputPort, InterruptFlag::TXE>;
 
+/**
+ * @brief 	This function disables USART tx data register empty interrupt
+ * @tparam	InputPort  		@ref usart::Port
+ */
+template <Port InputPort>
+constexpr auto disable_txe_irq = disable_irq<InputPort, InterruptFlag::TXE>;
+
+/**
+ * @brief 	This function enables USART rx data register not empty interrupt
+ * @tparam	InputPort  		@ref usart::Port
+ */
+template <Port InputPort>
+constexpr auto enable_rxne_irq = enable_irq<InputPort, InterruptFlag::RXNE>;
+
 /**
  * @brief 	This function enables USART half duplex
  * @tparam	InputPort  		@ref usart::Port
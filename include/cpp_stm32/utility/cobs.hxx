@@ -0,0 +1,293 @@
+// Copyright (c) 2020 by osjacky430.
+// All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the Lesser GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// Lesser GNU General Public License for more details.
+//
+// You should have received a copy of the Lesser GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "cpp_stm32/utility/crc.hxx"
+#include "cpp_stm32/utility/serial.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+/**
+ * Framing of binary packet: payload is followed by its CRC (little endian), the whole is COBS encoded, so that it
+ * contains no 0, and frame is terminated by 0. Receiver can resynchronize at any 0 after noise or lost bytes.
+ */
+namespace cpp_stm32 {
+
+/**
+ * @brief		This function returns buffer size needed by a frame of given payload size
+ */
+template <typename CrcType = Crc16Ccitt>
+constexpr std::size_t cobs_frame_size(std::size_t const t_payload) noexcept {
+	constexpr std::size_t MAX_BLOCK = 254;
+	auto const data_size						= t_payload + sizeof(typename CrcType::value_type);
+
+	// one code byte per (at most) 254 bytes, plus delimiter
+	return data_size + data_size / MAX_BLOCK + 1 + 1;
+}
+
+/**
+ * @class 	CobsEncoder
+ * @brief		Encodes payload into output buffer as it is written, e.g. directly into DMA transmit buffer
+ * @tparam	CrcType 	See @ref Crc
+ *
+ * @code{.cpp}
+ * 	std::array<std::uint8_t, cobs_frame_size(sizeof(Telemetry))> tx_buf;
+ *
+ * 	auto const frame = CobsEncoder{Span{tx_buf}}.write(telemetry).write(Span{extra}).finish();
+ * 	usart_tx.send(frame);
+ * @endcode
+ *
+ * @note 		Each code byte is back-patched once its block ends, the payload is copied only once, into output buffer.
+ */
+template <typename CrcType = Crc16Ccitt>
+class CobsEncoder {
+ private:
+	static constexpr std::uint8_t MAX_CODE = 0xFF;
+
+	Span<std::uint8_t> m_out;
+	std::size_t m_pos{1};			 /*!< Next position to write */
+	std::size_t m_codePos{0};	/*!< Position of code byte of current block */
+	std::uint8_t m_code{1};		 /*!< Code of current block, i.e. 1 + number of byte in it */
+	bool m_overflow{false};
+	CrcType m_crc{};
+
+	constexpr void put(std::uint8_t const t_byte) noexcept {
+		if (m_pos < m_out.size()) {
+			m_out[m_pos] = t_byte;
+		} else {
+			m_overflow = true;
+		}
+
+		++m_pos;
+	}
+
+	constexpr void closeBlock() noexcept {
+		if (m_codePos < m_out.size()) {
+			m_out[m_codePos] = m_code;
+		}
+
+		m_codePos = m_pos;
+		m_code		= 1;
+		put(0);	 // placeholder of next code byte
+	}
+
+	constexpr void encode(std::uint8_t const t_byte) noexcept {
+		if (t_byte == 0) {
+			closeBlock();
+			return;
+		}
+
+		put(t_byte);
+		if (++m_code == MAX_CODE) {
+			closeBlock();
+		}
+	}
+
+ public:
+	explicit constexpr CobsEncoder(Span<std::uint8_t> const t_out) noexcept : m_out(t_out) {}
+
+	constexpr CobsEncoder& write(std::uint8_t const t_byte) noexcept {
+		m_crc.update(t_byte);
+		encode(t_byte);
+		return *this;
+	}
+
+	constexpr CobsEncoder& write(Span<std::uint8_t const> const t_data) noexcept {
+		for (auto const byte : t_data) {
+			write(byte);
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	constexpr CobsEncoder& write(Serializable<T> const& t_val) noexcept {
+		for (auto const val : t_val.serialize()) {
+			write(static_cast<std::uint8_t>(val));
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief		This function appends CRC and delimiter
+	 * @return	Encoded frame in output buffer, empty if output buffer is too small, see @ref cobs_frame_size
+	 */
+	constexpr Span<std::uint8_t const> finish() noexcept {
+		auto crc = m_crc.value();
+		for (std::size_t i = 0; i < sizeof(crc); ++i) {
+			encode(static_cast<std::uint8_t>(crc & 0xFFU));
+			crc = static_cast<decltype(crc)>(crc >> 8U);
+		}
+
+		// the last block is never followed by an implicit 0
+		if (m_codePos < m_out.size()) {
+			m_out[m_codePos] = m_code;
+		}
+
+		put(0);
+
+		return m_overflow ? Span<std::uint8_t const>{} : Span<std::uint8_t const>{m_out.data(), m_pos};
+	}
+};
+
+/**
+ * @class 	CobsDecoder
+ * @brief		Incremental decoder, received bytes are fed as they come, e.g. from @ref driver::DmaRingRx
+ * @tparam	CrcType 	See @ref Crc
+ *
+ * @code{.cpp}
+ * 	std::array<std::uint8_t, 64> payload_buf;
+ * 	CobsDecoder decoder{Span{payload_buf}};
+ *
+ * 	auto const [first, second] = rx.peek();
+ * 	for (auto data = Span{first}; !data.empty();) {
+ * 		auto const used = decoder.feed(data);
+ * 		data						= data.subspan(used);
+ *
+ * 		if (decoder.complete()) {
+ * 			handle(decoder.payload());
+ * 		}
+ * 	}
+ * 	// same for second, then rx.consume(first.size() + second.size())
+ * @endcode
+ *
+ * @note 		CRC is computed on the fly, lagging behind by the size of CRC, there is no second pass over the frame.
+ */
+template <typename CrcType = Crc16Ccitt>
+class CobsDecoder {
+ private:
+	using CrcValue = typename CrcType::value_type;
+
+	static constexpr std::uint8_t MAX_CODE = 0xFF;
+	static constexpr auto CRC_SIZE				 = sizeof(CrcValue);
+
+	Span<std::uint8_t> m_buf;
+	std::size_t m_len{0};
+	std::size_t m_payloadLen{0};
+	std::uint32_t m_errorCount{0};
+	std::uint8_t m_remaining{0}; /*!< Number of byte left in current block */
+	bool m_zeroPending{false};	 /*!< Current block is followed by 0, unless it is the last one */
+	bool m_discard{false};			 /*!< Frame is corrupted, skip until delimiter */
+	bool m_complete{false};
+	CrcType m_crc{};
+
+	constexpr void append(std::uint8_t const t_byte) noexcept {
+		if (m_len == m_buf.size()) {
+			m_discard = true;
+			return;
+		}
+
+		if (m_len >= CRC_SIZE) {
+			m_crc.update(m_buf[m_len - CRC_SIZE]);
+		}
+
+		m_buf[m_len++] = t_byte;
+	}
+
+	constexpr void endFrame() noexcept {
+		if (m_len == 0 && !m_discard && m_remaining == 0) {
+			return;	// consecutive delimiters
+		}
+
+		CrcValue received = 0;
+		for (std::size_t i = 0; i < CRC_SIZE && CRC_SIZE <= m_len; ++i) {
+			received = static_cast<CrcValue>(received | static_cast<CrcValue>(m_buf[m_len - CRC_SIZE + i] << (8U * i)));
+		}
+
+		if (m_discard || m_remaining != 0 || m_len < CRC_SIZE || received != m_crc.value()) {
+			++m_errorCount;
+		} else {
+			m_payloadLen = m_len - CRC_SIZE;
+			m_complete	 = true;
+		}
+
+		m_len					= 0;
+		m_remaining		= 0;
+		m_zeroPending = false;
+		m_discard			= false;
+		m_crc.reset();
+	}
+
+ public:
+	/**
+	 * @param 	t_buf 	Decoded frame, payload and CRC, must hold payload size + size of CRC
+	 */
+	explicit constexpr CobsDecoder(Span<std::uint8_t> const t_buf) noexcept : m_buf(t_buf) {}
+
+	/**
+	 * @brief		This function decodes received byte
+	 * @return	true if a valid frame is completed by this byte, see @ref payload
+	 */
+	constexpr bool feed(std::uint8_t const t_byte) noexcept {
+		m_complete = false;
+
+		if (t_byte == 0) {
+			endFrame();
+		} else if (m_discard) {
+			// wait for delimiter
+		} else if (m_remaining == 0) {
+			if (m_zeroPending) {
+				append(0);
+			}
+
+			m_remaining		= static_cast<std::uint8_t>(t_byte - 1U);
+			m_zeroPending = t_byte != MAX_CODE;
+		} else {
+			append(t_byte);
+			--m_remaining;
+		}
+
+		return m_complete;
+	}
+
+	/**
+	 * @brief		This function decodes received bytes, and stops right after a valid frame is completed
+	 * @return	Number of byte consumed, the rest should be fed again after the frame is handled
+	 */
+	constexpr std::size_t feed(Span<std::uint8_t const> const t_data) noexcept {
+		std::size_t used = 0;
+		while (used < t_data.size()) {
+			if (feed(t_data[used++])) {
+				break;
+			}
+		}
+
+		return used;
+	}
+
+	/**
+	 * @brief		This function returns whether the last byte fed completes a valid frame
+	 */
+	[[nodiscard]] constexpr bool complete() const noexcept { return m_complete; }
+
+	/**
+	 * @brief		This function returns payload of the last valid frame, it stays valid until next byte is fed
+	 */
+	[[nodiscard]] constexpr Span<std::uint8_t const> payload() const noexcept {
+		return Span<std::uint8_t const>{m_buf.data(), m_payloadLen};
+	}
+
+	/**
+	 * @brief		This function returns number of frame dropped due to CRC mismatch, truncation or overflow
+	 */
+	[[nodiscard]] constexpr std::uint32_t errorCount() const noexcept { return m_errorCount; }
+};
+
+}	 // namespace cpp_stm32
@@ -0,0 +1,263 @@
+// Copyright (c) 2020 by osjacky430.
+// All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the Lesser GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// Lesser GNU General Public License for more details.
+//
+// You should have received a copy of the Lesser GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "cpp_stm32/utility/span.hxx"
+
+namespace cpp_stm32 {
+
+/**
+ * @class 	Crc
+ * @brief		Table driven software CRC, one table lookup per byte, table is generated at compile time
+ * @tparam	T 					Unsigned type of CRC width
+ * @tparam	Poly 				Generator polynomial, normal (MSB first) form
+ * @tparam	Init 				Initial value
+ * @tparam	Reflected 	Input and output are bit reflected (LSB first)
+ * @tparam	XorOut 			Value xor-ed to the result
+ *
+ * @code{.cpp}
+ * 	Crc32 crc;
+ * 	crc.update(Span{header}).update(Span{payload});
+ * 	auto const checksum = crc.value();
+ * @endcode
+ */
+template <typename T, T Poly, T Init, bool Reflected, T XorOut>
+class Crc {
+ private:
+	static_assert(std::is_unsigned_v<T> && sizeof(T) <= sizeof(std::uint32_t));
+
+	static constexpr auto WIDTH = 8U * sizeof(T);
+	static constexpr T TOP_BIT	= static_cast<T>(T{1} << (WIDTH - 1U));
+
+	static constexpr T reflect(T const t_val) noexcept {
+		T ret_val = 0;
+		for (std::size_t i = 0; i < WIDTH; ++i) {
+			if ((t_val & static_cast<T>(T{1} << i)) != 0) {
+				ret_val = static_cast<T>(ret_val | static_cast<T>(TOP_BIT >> i));
+			}
+		}
+
+		return ret_val;
+	}
+
+	T m_crc{Init};
+
+ public:
+	using value_type = T;
+
+	static constexpr T INIT					= Init;
+	static constexpr T XOR_OUT			= XorOut;
+	static constexpr bool REFLECTED = Reflected;
+
+	/**
+	 * @brief		CRC of each byte value, shifted into register of value 0
+	 */
+	static constexpr auto TABLE = []() {
+		std::array<T, 256> ret_val{};
+
+		for (std::size_t i = 0; i < ret_val.size(); ++i) {
+			auto crc = static_cast<T>(Reflected ? i : i << (WIDTH - 8U));
+
+			for (int bit = 0; bit < 8; ++bit) {
+				if constexpr (Reflected) {
+					crc = static_cast<T>((crc & 1U) != 0 ? (crc >> 1U) ^ reflect(Poly) : crc >> 1U);
+				} else {
+					crc = static_cast<T>((crc & TOP_BIT) != 0 ? (crc << 1U) ^ Poly : crc << 1U);
+				}
+			}
+
+			ret_val[i] = crc;
+		}
+
+		return ret_val;
+	}();
+
+	constexpr Crc() noexcept = default;
+
+	constexpr void reset() noexcept { m_crc = Init; }
+
+	constexpr Crc& update(std::uint8_t const t_byte) noexcept {
+		if constexpr (Reflected) {
+			m_crc = static_cast<T>((m_crc >> 8U) ^ TABLE[(m_crc ^ t_byte) & 0xFFU]);
+		} else if constexpr (WIDTH == 8) {
+			m_crc = TABLE[m_crc ^ t_byte];
+		} else {
+			m_crc = static_cast<T>((m_crc << 8U) ^ TABLE[((m_crc >> (WIDTH - 8U)) ^ t_byte) & 0xFFU]);
+		}
+
+		return *this;
+	}
+
+	constexpr Crc& update(Span<std::uint8_t const> const t_data) noexcept {
+		for (auto const byte : t_data) {
+			update(byte);
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief		This function returns CRC of the data so far, more data can still be appended
+	 */
+	[[nodiscard]] constexpr T value() const noexcept { return static_cast<T>(m_crc ^ XorOut); }
+
+	[[nodiscard]] static constexpr T compute(Span<std::uint8_t const> const t_data) noexcept {
+		return Crc{}.update(t_data).value();
+	}
+};
+
+/**
+ * @brief		CRC-16/CCITT-FALSE, check value of "123456789" is 0x29B1
+ */
+using Crc16Ccitt = Crc<std::uint16_t, 0x1021U, 0xFFFFU, false, 0U>;
+
+/**
+ * @brief		CRC-32 of ethernet, zip, etc., check value of "123456789" is 0xCBF43926
+ */
+using Crc32 = Crc<std::uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, true, 0xFFFFFFFFU>;
+
+/**
+ * @brief		CRC-32/MPEG-2, i.e. what the CRC unit of stm32f4 computes, check value of "123456789" is 0x0376E6E7
+ */
+using Crc32Mpeg2 = Crc<std::uint32_t, 0x04C11DB7U, 0xFFFFFFFFU, false, 0U>;
+
+/**
+ * @class 	SlicedCrc
+ * @brief		Slice-by-8 software CRC, 8 byte per iteration with 8 independent table lookups instead of 8 dependent ones,
+ * 					at the cost of 8 KiB table, gives the same result as @ref Crc of the same parameter.
+ * @tparam	CrcType 	32 bit @ref Crc, e.g. @ref Crc32, @ref Crc32Mpeg2
+ *
+ * @note 		Bytes are assembled by shift, the result doesn't depend on endianness of host.
+ */
+template <typename CrcType>
+class SlicedCrc {
+ private:
+	static_assert(std::is_same_v<typename CrcType::value_type, std::uint32_t>, "Only 32 bit CRC is supported");
+
+	static constexpr auto TABLES = []() {
+		std::array<std::array<std::uint32_t, 256>, 8> ret_val{CrcType::TABLE};
+
+		for (std::size_t k = 1; k < ret_val.size(); ++k) {
+			for (std::size_t i = 0; i < 256; ++i) {
+				auto const prev = ret_val[k - 1][i];
+				ret_val[k][i]		= CrcType::REFLECTED ? (prev >> 8U) ^ ret_val[0][prev & 0xFFU]
+																							 : (prev << 8U) ^ ret_val[0][prev >> 24U];
+			}
+		}
+
+		return ret_val;
+	}();
+
+	std::uint32_t m_crc{CrcType::INIT};
+
+	/**
+	 * @brief		This function shifts 8 byte into CRC register
+	 * @param 	t_first 	First 4 byte, in the order they are shifted in, i.e. the first one in LSB if reflected, MSB if not
+	 * @param 	t_second 	Next 4 byte, same order as t_first
+	 */
+	constexpr void update8(std::uint32_t const t_first, std::uint32_t const t_second) noexcept {
+		auto const one	= m_crc ^ t_first;
+		auto const& tbl = TABLES;
+
+		if constexpr (CrcType::REFLECTED) {
+			m_crc = tbl[7][one & 0xFFU] ^ tbl[6][(one >> 8U) & 0xFFU] ^ tbl[5][(one >> 16U) & 0xFFU] ^ tbl[4][one >> 24U] ^
+							tbl[3][t_second & 0xFFU] ^ tbl[2][(t_second >> 8U) & 0xFFU] ^ tbl[1][(t_second >> 16U) & 0xFFU] ^
+							tbl[0][t_second >> 24U];
+		} else {
+			m_crc = tbl[7][one >> 24U] ^ tbl[6][(one >> 16U) & 0xFFU] ^ tbl[5][(one >> 8U) & 0xFFU] ^ tbl[4][one & 0xFFU] ^
+							tbl[3][t_second >> 24U] ^ tbl[2][(t_second >> 16U) & 0xFFU] ^ tbl[1][(t_second >> 8U) & 0xFFU] ^
+							tbl[0][t_second & 0xFFU];
+		}
+	}
+
+	static constexpr std::uint32_t load(std::uint8_t const* const t_data) noexcept {
+		if constexpr (CrcType::REFLECTED) {
+			return std::uint32_t{t_data[0]} | (std::uint32_t{t_data[1]} << 8U) | (std::uint32_t{t_data[2]} << 16U) |
+						 (std::uint32_t{t_data[3]} << 24U);
+		} else {
+			return (std::uint32_t{t_data[0]} << 24U) | (std::uint32_t{t_data[1]} << 16U) | (std::uint32_t{t_data[2]} << 8U) |
+						 std::uint32_t{t_data[3]};
+		}
+	}
+
+	constexpr void updateByte(std::uint8_t const t_byte) noexcept {
+		if constexpr (CrcType::REFLECTED) {
+			m_crc = (m_crc >> 8U) ^ TABLES[0][(m_crc ^ t_byte) & 0xFFU];
+		} else {
+			m_crc = (m_crc << 8U) ^ TABLES[0][(m_crc >> 24U) ^ t_byte];
+		}
+	}
+
+ public:
+	using value_type = std::uint32_t;
+
+	constexpr SlicedCrc() noexcept = default;
+
+	constexpr void reset() noexcept { m_crc = CrcType::INIT; }
+
+	constexpr SlicedCrc& update(Span<std::uint8_t const> const t_data) noexcept {
+		auto const* data = t_data.data();
+		auto remain			 = t_data.size();
+
+		for (; remain >= 8; remain -= 8, data += 8) {
+			update8(load(data), load(data + 4));
+		}
+
+		for (; remain != 0; --remain, ++data) {
+			updateByte(*data);
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief		This function shifts in words the way CRC unit of stm32 does, i.e. MSB of each word first, so that
+	 * 					SlicedCrc<Crc32Mpeg2> gives the same result as the hardware
+	 */
+	constexpr SlicedCrc& update(Span<std::uint32_t const> const t_words) noexcept {
+		static_assert(!CrcType::REFLECTED, "Word is shifted in MSB first");
+
+		auto const* data = t_words.data();
+		auto remain			 = t_words.size();
+
+		for (; remain >= 2; remain -= 2, data += 2) {
+			update8(data[0], data[1]);
+		}
+
+		if (remain != 0) {
+			for (std::uint32_t shift = 32U; shift != 0; shift -= 8U) {
+				updateByte(static_cast<std::uint8_t>(*data >> (shift - 8U)));
+			}
+		}
+
+		return *this;
+	}
+
+	[[nodiscard]] constexpr std::uint32_t value() const noexcept { return m_crc ^ CrcType::XOR_OUT; }
+
+	template <typename T>
+	[[nodiscard]] static constexpr std::uint32_t compute(Span<T const> const t_data) noexcept {
+		return SlicedCrc{}.update(t_data).value();
+	}
+};
+
+}	 // namespace cpp_stm32
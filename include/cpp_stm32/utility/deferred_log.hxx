@@ -0,0 +1,230 @@
+// Copyright (c) 2020 by osjacky430.
+// All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the Lesser GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// Lesser GNU General Public License for more details.
+//
+// You should have received a copy of the Lesser GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "cpp_stm32/utility/format.hxx"
+#include "cpp_stm32/utility/span.hxx"
+
+/**
+ * Deferred logging: the format string, together with the type of each argument, is placed in section .cpp_stm32_log,
+ * which is kept in ELF but not loaded (see cortex-m-generic.ld). At run time only the offset of the string in that
+ * section (the string id) and the raw bytes of the arguments are sent, and tool/log_decoder renders the text on host.
+ *
+ * @code{.cpp}
+ * 	DeferredLogger logger{pc};		// anything with send(Span<std::uint8_t const>)
+ * 	CPP_STM32_LOG(logger, "x={} y={:.3f} state={:02x}", x, y, state);
+ * @endcode
+ *
+ * Record layout, little endian: string id (2 bytes), then the arguments in order, each in its own size. Format string
+ * uses the syntax of @ref format, i.e. python str.format, and is checked against the arguments at compile time, enum is
+ * checked as its underlying type.
+ *
+ * @note 		GCC ignores section attribute of variables in template, therefore CPP_STM32_LOG must be used in non-template
+ * 					function, otherwise the string is placed in .rodata and can't be found by decoder.
+ */
+namespace cpp_stm32::log {
+
+/**
+ * @brief		Type an argument is logged as, i.e. enum is logged as its underlying type
+ */
+template <typename T>
+using LogArg_t = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::common_type<T>>::type;
+
+/**
+ * @brief		This function returns the code of argument type, same as python struct module
+ */
+template <typename T>
+constexpr char type_code() noexcept {
+	using Arg = LogArg_t<T>;
+
+	static_assert(std::is_arithmetic_v<Arg>, "Only arithmetic and enum type can be logged");
+
+	if constexpr (std::is_same_v<Arg, bool>) {
+		return '?';
+	} else if constexpr (std::is_same_v<Arg, char>) {
+		return 'c';
+	} else if constexpr (std::is_floating_point_v<Arg>) {
+		static_assert(sizeof(Arg) == 4 || sizeof(Arg) == 8);
+		return sizeof(Arg) == 4 ? 'f' : 'd';
+	} else {
+		constexpr std::array SIGNED{'b', 'h', 'i', 'q'};
+		constexpr std::array UNSIGNED{'B', 'H', 'I', 'Q'};
+		constexpr auto IDX = sizeof(Arg) == 1 ? 0 : (sizeof(Arg) == 2 ? 1 : (sizeof(Arg) == 4 ? 2 : 3));
+
+		return std::is_signed_v<Arg> ? SIGNED[IDX] : UNSIGNED[IDX];
+	}
+}
+
+/**
+ * @class 	Arguments
+ * @brief		Arguments of one log record, the type is used in unevaluated context to describe the record
+ */
+template <typename... Args>
+struct Arguments {
+	std::tuple<Args...> values;
+
+	static constexpr std::size_t SIZE = (std::size_t{0} + ... + sizeof(Args));
+	// starts with byte order mark of python struct, so that entry never starts with 0, which is padding
+	static constexpr std::array<char, sizeof...(Args) + 2> SIGNATURE{'<', type_code<Args>()..., '\0'};
+
+	/**
+	 * @brief		This function checks format string, the number of replacement field, and the type of each field against
+	 * 					the arguments, with the same rule as @ref format
+	 */
+	template <std::size_t N>
+	static constexpr bool isValidFormat(char const (&t_fmt)[N]) noexcept {
+		auto const parsed = detail::parse_format(t_fmt);
+		return parsed.valid && parsed.fieldNum == sizeof...(Args) &&
+					 isValidField(parsed, std::index_sequence_for<Args...>{});
+	}
+
+ private:
+	template <std::size_t N, std::size_t... Idx>
+	static constexpr bool isValidField(detail::ParsedFormat<N> const& t_parsed,
+																		 std::index_sequence<Idx...> const /*unused*/) noexcept {
+		// argIdx of the n-th field is n, and fields are in the order of pieces
+		std::array<detail::FormatPiece, sizeof...(Args) + 1> field{};
+		for (std::size_t i = 0, n = 0; i < t_parsed.pieceNum; ++i) {
+			if (t_parsed.pieces[i].isField) {
+				field[n++] = t_parsed.pieces[i];
+			}
+		}
+
+		return (true && ... && detail::is_valid_field<LogArg_t<Args>>(field[Idx]));
+	}
+};
+
+/**
+ * @brief		This function collects the arguments following format string
+ */
+template <std::size_t N, typename... Args>
+constexpr auto capture(char const (& /*unused*/)[N], Args const... t_args) noexcept {
+	return Arguments<Args...>{std::tuple{t_args...}};
+}
+
+/**
+ * @brief		This function concatenates signature (e.g. "<If") and format string, both null terminated
+ */
+template <typename Args, std::size_t N>
+constexpr auto make_entry(char const (&t_fmt)[N]) noexcept {
+	constexpr auto& SIGNATURE = Args::SIGNATURE;
+	std::array<char, SIGNATURE.size() + N> ret_val{};
+
+	for (std::size_t i = 0; i < SIGNATURE.size(); ++i) {
+		ret_val[i] = SIGNATURE[i];
+	}
+
+	for (std::size_t i = 0; i < N; ++i) {
+		ret_val[SIGNATURE.size() + i] = t_fmt[i];
+	}
+
+	return ret_val;
+}
+
+/**
+ * @brief		Whether the sink reports free space by writable(), i.e. its send may accept only part of the data
+ */
+template <typename Sink, typename = void>
+struct HasWritable : std::false_type {};
+
+template <typename Sink>
+struct HasWritable<Sink, std::void_t<decltype(std::declval<Sink const&>().writable())>> : std::true_type {};
+
+/**
+ * @class 	DeferredLogger
+ * @brief		Sends log record to sink as one write
+ * @tparam	Sink 	Type that has send(Span<std::uint8_t const>), e.g. @ref driver::BufferedUsart. If it also has
+ * 					writable(), record is queued as a whole or not at all, a truncated record would make decoder lose sync
+ *
+ * @note 		Logger adds no locking, it is as reentrant as the sink. Sink with single producer, e.g. BufferedUsart, must
+ * 					only be logged to from one context, otherwise records from thread and interrupt corrupt each other. Give each
+ * 					context its own logger and sink instead, e.g. one port per context.
+ */
+template <typename Sink>
+class DeferredLogger {
+ private:
+	Sink& m_sink;
+	std::uint32_t m_dropped{0};
+
+ public:
+	explicit constexpr DeferredLogger(Sink& t_sink) noexcept : m_sink(t_sink) {}
+
+	/**
+	 * @brief		This function sends log record, use CPP_STM32_LOG instead
+	 * @param 	t_entry 	Entry in .cpp_stm32_log
+	 * @param 	t_args 		Arguments
+	 */
+	template <std::size_t N, typename... Args>
+	void write(std::array<char, N> const& t_entry, Arguments<Args...> const& t_args) noexcept {
+		constexpr auto ID_SIZE = sizeof(std::uint16_t);
+		std::array<std::uint8_t, ID_SIZE + Arguments<Args...>::SIZE> record{};
+
+		// the section starts at 0, see linker script
+		auto const id = static_cast<std::uint16_t>(reinterpret_cast<std::uintptr_t>(t_entry.data()));
+		record[0]			= static_cast<std::uint8_t>(id & 0xFFU);
+		record[1]			= static_cast<std::uint8_t>(id >> 8U);
+
+		std::apply(
+			[&record](Args const&... t_val) {
+				[[maybe_unused]] auto* out = record.data() + ID_SIZE;
+				((std::memcpy(out, &t_val, sizeof(Args)), out += sizeof(Args)), ...);
+			},
+			t_args.values);
+
+		if constexpr (HasWritable<Sink>::value) {
+			if (m_sink.writable() < record.size()) {
+				++m_dropped;
+				return;
+			}
+		}
+
+		m_sink.send(Span<std::uint8_t const>{record.data(), record.size()});
+	}
+
+	/**
+	 * @brief		This function returns number of record dropped since the sink didn't have room for it
+	 */
+	[[nodiscard]] std::uint32_t dropped() const noexcept { return m_dropped; }
+};
+
+}	 // namespace cpp_stm32::log
+
+#define CPP_STM32_LOG_FIRST_IMPL(t_first, ...) t_first
+#define CPP_STM32_LOG_FIRST(...) CPP_STM32_LOG_FIRST_IMPL(__VA_ARGS__, 0)
+
+/**
+ * @brief		Logs format string and arguments, e.g. CPP_STM32_LOG(logger, "x={}", x)
+ * @param 	t_logger 	@ref cpp_stm32::log::DeferredLogger
+ * @param 	... 			Format string literal, then arguments
+ */
+#define CPP_STM32_LOG(t_logger, ...)                                                                             \
+	do {                                                                                                           \
+		using CppStm32LogArgs = decltype(::cpp_stm32::log::capture(__VA_ARGS__));                                    \
+		static_assert(CppStm32LogArgs::isValidFormat(CPP_STM32_LOG_FIRST(__VA_ARGS__)),                              \
+									"Format string doesn't match the arguments");                                                  \
+		__attribute__((section(".cpp_stm32_log"), used)) static constexpr auto CPP_STM32_LOG_ENTRY =                 \
+			::cpp_stm32::log::make_entry<CppStm32LogArgs>(CPP_STM32_LOG_FIRST(__VA_ARGS__));                           \
+		(t_logger).write(CPP_STM32_LOG_ENTRY, ::cpp_stm32::log::capture(__VA_ARGS__));                               \
+	} while (false)
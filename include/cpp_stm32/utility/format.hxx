@@ -0,0 +1,441 @@
+// Copyright (c) 2020 by osjacky430.
+// All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the Lesser GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// Lesser GNU General Public License for more details.
+//
+// You should have received a copy of the Lesser GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Format string is parsed at compile time, and the arguments are formatted into one buffer on stack whose size is
+ * the worst case length, also computed at compile time. C++17 doesn't allow string literal as template argument, the
+ * format string is therefore given as a constexpr char array with static storage duration, e.g.
+ *
+ * @code{.cpp}
+ * 	static constexpr char TELEMETRY[] = "x={} y={:.3f} id={:04x}\n";
+ * 	auto const str = format<TELEMETRY>(x, y, id);		// str.view() is std::string_view of the result
+ * @endcode
+ *
+ * Replacement field is {[:[0][width][.precision][type]]}, "{{" and "}}" are escaped braces:
+ * 	- 0 					pad with zero instead of space, the text is always right aligned
+ * 	- width 			minimum number of characters, 0 to 64
+ * 	- precision 	number of digits after decimal point, 0 to 9, floating point only, default 6
+ * 	- type 				d (decimal), x / X (hex), f (fixed point), c (character), default depends on argument type
+ *
+ * Arguments can be integral, floating point, bool or char. Floating point is printed in fixed point notation by
+ * integer arithmetic in the argument type (use float instead of double on single precision FPU), magnitude no less
+ * than 2^32 is printed as "ovf".
+ */
+namespace cpp_stm32 {
+
+namespace detail {
+
+static constexpr std::uint32_t MAX_FIELD_WIDTH		 = 64;
+static constexpr std::uint32_t MAX_FIELD_PRECISION = 9;
+
+struct FormatPiece {
+	bool isField{false};
+	std::size_t begin{0};			/*!< Position of literal text in format string */
+	std::size_t length{0};		/*!< Length of literal text */
+	std::size_t argIdx{0};
+	char type{'\0'};
+	bool zeroPad{false};
+	std::uint8_t width{0};
+	std::int8_t precision{-1};
+};
+
+template <std::size_t N>
+struct ParsedFormat {
+	std::array<FormatPiece, N> pieces{};
+	std::size_t pieceNum{0};
+	std::size_t fieldNum{0};
+	bool valid{true};
+};
+
+constexpr bool is_digit(char const t_chr) noexcept { return '0' <= t_chr && t_chr <= '9'; }
+
+/**
+ * @brief		This function splits format string into literal text and replacement field
+ * @param 	t_fmt 	Null terminated format string
+ */
+template <std::size_t N>
+constexpr auto parse_format(char const (&t_fmt)[N]) noexcept {
+	ParsedFormat<N> ret_val{};
+	constexpr auto LEN = N - 1;
+
+	auto const add_literal = [&](std::size_t const t_begin, std::size_t const t_len) {
+		if (t_len != 0) {
+			ret_val.pieces[ret_val.pieceNum++] = FormatPiece{false, t_begin, t_len};
+		}
+	};
+
+	std::size_t literal_begin = 0;
+	std::size_t idx						= 0;
+
+	// digits stop accumulating once the value exceeds the limits, so that it is range checked before narrowing, instead
+	// of wrapping around into a valid width or precision
+	auto const parse_number = [&]() {
+		std::uint32_t val = 0;
+		for (; idx < LEN && is_digit(t_fmt[idx]); ++idx) {
+			if (val <= MAX_FIELD_WIDTH) {
+				val = val * 10U + static_cast<std::uint32_t>(t_fmt[idx] - '0');
+			}
+		}
+
+		return val;
+	};
+
+	while (idx < LEN && ret_val.valid) {
+		auto const chr = t_fmt[idx];
+
+		if (chr == '}') {
+			// "}}" is printed as one '}', single '}' is not allowed
+			ret_val.valid = idx + 1 < LEN && t_fmt[idx + 1] == '}';
+			add_literal(literal_begin, idx + 1 - literal_begin);
+			idx += 2;
+			literal_begin = idx;
+		} else if (chr != '{') {
+			++idx;
+		} else if (idx + 1 < LEN && t_fmt[idx + 1] == '{') {
+			add_literal(literal_begin, idx + 1 - literal_begin);
+			idx += 2;
+			literal_begin = idx;
+		} else {
+			add_literal(literal_begin, idx - literal_begin);
+
+			FormatPiece field{true};
+			field.argIdx = ret_val.fieldNum++;
+			++idx;
+
+			if (idx < LEN && t_fmt[idx] == ':') {
+				++idx;
+
+				if (idx < LEN && t_fmt[idx] == '0') {
+					field.zeroPad = true;
+					++idx;
+				}
+
+				auto const width = parse_number();
+				ret_val.valid		 = width <= MAX_FIELD_WIDTH;
+				field.width			 = static_cast<std::uint8_t>(width);
+
+				if (idx < LEN && t_fmt[idx] == '.') {
+					++idx;
+					ret_val.valid				 = ret_val.valid && idx < LEN && is_digit(t_fmt[idx]);
+					auto const precision = parse_number();
+					ret_val.valid				 = ret_val.valid && precision <= MAX_FIELD_PRECISION;
+					field.precision			 = static_cast<std::int8_t>(precision);
+				}
+
+				if (idx < LEN && t_fmt[idx] != '}') {
+					field.type = t_fmt[idx++];
+				}
+			}
+
+			ret_val.valid = ret_val.valid && idx < LEN && t_fmt[idx] == '}';
+			ret_val.pieces[ret_val.pieceNum++] = field;
+
+			++idx;
+			literal_begin = idx;
+		}
+	}
+
+	if (literal_begin < LEN) {
+		add_literal(literal_begin, LEN - literal_begin);
+	}
+
+	return ret_val;
+}
+
+template <typename T>
+using FormatArg_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+/**
+ * @brief		This function checks if the type in replacement field can be applied to argument
+ */
+template <typename T>
+constexpr bool is_valid_field(FormatPiece const& t_field) noexcept {
+	switch (t_field.type) {
+		case '\0':
+			return std::is_arithmetic_v<T> && (t_field.precision < 0 || std::is_floating_point_v<T>);
+		case 'd':
+		case 'x':
+		case 'X':
+			return std::is_integral_v<T> && !std::is_same_v<T, bool> && t_field.precision < 0;
+		case 'c':
+			return std::is_integral_v<T> && !std::is_same_v<T, bool> && t_field.precision < 0;
+		case 'f':
+			return std::is_floating_point_v<T>;
+		default:
+			return false;
+	}
+}
+
+/**
+ * @brief		This function returns max number of characters the argument is formatted into
+ */
+template <typename T>
+constexpr std::size_t max_field_length(FormatPiece const& t_field) noexcept {
+	std::size_t len = 0;
+
+	if constexpr (std::is_same_v<T, bool>) {
+		len = 5;	// "false"
+	} else if constexpr (std::is_floating_point_v<T>) {
+		auto const precision = t_field.precision < 0 ? 6U : static_cast<unsigned>(t_field.precision);
+		len									 = 1 + 10 + 1 + precision;	// sign, 2^32 - 1, decimal point and fraction
+	} else if (t_field.type == 'c' || (t_field.type == '\0' && std::is_same_v<T, char>)) {
+		len = 1;
+	} else if (t_field.type == 'x' || t_field.type == 'X') {
+		len = sizeof(T) * 2;
+	} else {
+		len = std::numeric_limits<T>::digits10 + 2;	 // digits10 is one less than the max number of digits, plus sign
+	}
+
+	return len < t_field.width ? t_field.width : len;
+}
+
+/**
+ * @brief		This function writes unsigned number backward, from t_last
+ * @return	Pointer to the first character
+ */
+template <typename T>
+constexpr char* write_unsigned_backward(char* t_last, T t_val, unsigned const t_base, bool const t_upper) noexcept {
+	constexpr std::string_view LOWER = "0123456789abcdef";
+	constexpr std::string_view UPPER = "0123456789ABCDEF";
+
+	do {
+		*--t_last = (t_upper ? UPPER : LOWER)[t_val % t_base];
+		t_val = static_cast<T>(t_val / t_base);
+	} while (t_val != 0);
+
+	return t_last;
+}
+
+/**
+ * @brief		This function copies the text right aligned to width, sign is put before zero padding
+ * @return	Pointer to the end of output
+ */
+constexpr char* write_padded(char* t_out, char const* t_first, char const* const t_last, bool const t_neg,
+														 FormatPiece const& t_field) noexcept {
+	auto const len = static_cast<std::size_t>(t_last - t_first) + static_cast<std::size_t>(t_neg);
+	auto pad			 = len < t_field.width ? t_field.width - len : 0U;
+
+	if (!t_field.zeroPad) {
+		for (; pad != 0; --pad) {
+			*t_out++ = ' ';
+		}
+	}
+
+	if (t_neg) {
+		*t_out++ = '-';
+	}
+
+	for (; pad != 0; --pad) {
+		*t_out++ = '0';
+	}
+
+	while (t_first != t_last) {
+		*t_out++ = *t_first++;
+	}
+
+	return t_out;
+}
+
+/**
+ * @brief		This function formats one argument according to the replacement field
+ * @return	Pointer to the end of output
+ */
+template <typename T>
+constexpr char* format_field(char* t_out, T const t_val, FormatPiece const& t_field) noexcept {
+	// wide enough for the longest number, max_field_length doesn't count padding
+	std::array<char, 24> digits{};
+	auto* const last = digits.data() + digits.size();
+	char* first			 = last;
+	bool neg				 = false;
+
+	if constexpr (std::is_same_v<T, bool>) {
+		constexpr std::string_view TRUE_STR	 = "true";
+		constexpr std::string_view FALSE_STR = "false";
+
+		auto const str = t_val ? TRUE_STR : FALSE_STR;
+		return write_padded(t_out, str.data(), str.data() + str.size(), false, t_field);
+	} else if constexpr (std::is_floating_point_v<T>) {
+		constexpr T OVERFLOW_LIMIT				 = static_cast<T>(4294967296.0);
+		constexpr std::string_view OVF_STR = "ovf";
+
+		auto const precision = t_field.precision < 0 ? 6U : static_cast<unsigned>(t_field.precision);
+		neg									 = t_val < 0;
+		auto const abs_val	 = neg ? -t_val : t_val;
+
+		if (!(abs_val < OVERFLOW_LIMIT)) {	// also true for nan
+			constexpr std::string_view NAN_STR = "nan";
+
+			auto const str = abs_val != abs_val ? NAN_STR : OVF_STR;
+			return write_padded(t_out, str.data(), str.data() + str.size(), neg, t_field);
+		}
+
+		std::uint32_t scale = 1;
+		for (unsigned i = 0; i < precision; ++i) {
+			scale *= 10;
+		}
+
+		auto int_part	 = static_cast<std::uint32_t>(abs_val);
+		auto frac_part = static_cast<std::uint32_t>((abs_val - static_cast<T>(int_part)) * static_cast<T>(scale) + T{0.5});
+
+		// rounding may carry into integer part, e.g. 0.9996 with 3 digits of precision
+		if (frac_part >= scale) {
+			// value rounded up to 2^32 doesn't fit either, e.g. 4294967295.9999
+			if (int_part == std::numeric_limits<std::uint32_t>::max()) {
+				return write_padded(t_out, OVF_STR.data(), OVF_STR.data() + OVF_STR.size(), neg, t_field);
+			}
+
+			frac_part -= scale;
+			++int_part;
+		}
+
+		if (precision != 0) {
+			for (unsigned i = 0; i < precision; ++i) {
+				*--first = static_cast<char>('0' + frac_part % 10);
+				frac_part /= 10;
+			}
+
+			*--first = '.';
+		}
+
+		first = write_unsigned_backward(first, int_part, 10, false);
+	} else if (t_field.type == 'c' || (t_field.type == '\0' && std::is_same_v<T, char>)) {
+		*--first = static_cast<char>(t_val);
+	} else {
+		using Unsigned = std::make_unsigned_t<T>;
+
+		auto const is_hex = t_field.type == 'x' || t_field.type == 'X';
+		neg								= !is_hex && t_val < 0;
+
+		// negate in unsigned type, so that the min value doesn't overflow
+		auto const unsigned_val	= static_cast<Unsigned>(t_val);
+		auto const abs_val			= neg ? static_cast<Unsigned>(Unsigned{0} - unsigned_val) : unsigned_val;
+		first										= write_unsigned_backward(first, abs_val, is_hex ? 16U : 10U, t_field.type == 'X');
+	}
+
+	return write_padded(t_out, first, last, neg, t_field);
+}
+
+template <auto const& Fmt>
+inline constexpr auto PARSED_FORMAT = parse_format(Fmt);
+
+/**
+ * @brief		This function returns max number of characters the piece is formatted into
+ */
+template <auto const& Fmt, std::size_t PieceIdx, typename ArgTuple>
+constexpr std::size_t max_piece_length() noexcept {
+	constexpr auto PIECE = PARSED_FORMAT<Fmt>.pieces[PieceIdx];
+
+	if constexpr (PIECE.isField) {
+		return max_field_length<std::tuple_element_t<PIECE.argIdx, ArgTuple>>(PIECE);
+	} else {
+		return PIECE.length;
+	}
+}
+
+template <auto const& Fmt, typename ArgTuple, std::size_t... PieceIdx>
+constexpr std::size_t max_format_length(std::index_sequence<PieceIdx...> const /*unused*/) noexcept {
+	return (std::size_t{0} + ... + max_piece_length<Fmt, PieceIdx, ArgTuple>());
+}
+
+/**
+ * @brief		This function writes literal text, or formats the argument of replacement field
+ * @return	Pointer to the end of output
+ */
+template <auto const& Fmt, std::size_t PieceIdx, typename ArgTuple>
+constexpr char* format_piece(char* t_out, ArgTuple const& t_args) noexcept {
+	constexpr auto PIECE = PARSED_FORMAT<Fmt>.pieces[PieceIdx];
+
+	if constexpr (PIECE.isField) {
+		using Arg = std::tuple_element_t<PIECE.argIdx, ArgTuple>;
+		static_assert(is_valid_field<Arg>(PIECE), "Replacement field type doesn't match argument type");
+
+		return format_field(t_out, std::get<PIECE.argIdx>(t_args), PIECE);
+	} else {
+		for (std::size_t i = 0; i < PIECE.length; ++i) {
+			*t_out++ = Fmt[PIECE.begin + i];
+		}
+
+		return t_out;
+	}
+}
+
+template <auto const& Fmt, typename ArgTuple, std::size_t... PieceIdx>
+constexpr char* format_pieces(char* t_out, ArgTuple const& t_args,
+															std::index_sequence<PieceIdx...> const /*unused*/) noexcept {
+	((t_out = format_piece<Fmt, PieceIdx>(t_out, t_args)), ...);
+	return t_out;
+}
+
+}	 // namespace detail
+
+/**
+ * @class 	FormattedString
+ * @brief		Result of @ref format, character buffer of worst case length
+ */
+template <std::size_t N>
+class FormattedString {
+ private:
+	std::array<char, N> m_data{};
+	std::size_t m_size{0};
+
+ public:
+	constexpr FormattedString() noexcept = default;
+
+	[[nodiscard]] constexpr auto data() noexcept { return m_data.data(); }
+	[[nodiscard]] constexpr auto data() const noexcept { return m_data.data(); }
+	[[nodiscard]] constexpr auto size() const noexcept { return m_size; }
+	[[nodiscard]] static constexpr auto capacity() noexcept { return N; }
+	[[nodiscard]] constexpr auto view() const noexcept { return std::string_view{m_data.data(), m_size}; }
+
+	constexpr void resize(std::size_t const t_size) noexcept { m_size = t_size; }
+};
+
+/**
+ * @brief		This function formats arguments according to format string, in one pass without bounds checking, since
+ * 					the buffer is as long as the worst case
+ * @tparam	Fmt 	Format string, constexpr char array with static storage duration
+ * @return	@ref FormattedString
+ */
+template <auto const& Fmt, typename... Args>
+[[nodiscard]] constexpr auto format(Args const... t_args) noexcept {
+	using ArgTuple = std::tuple<detail::FormatArg_t<Args>...>;
+
+	constexpr auto& PARSED = detail::PARSED_FORMAT<Fmt>;
+	static_assert(PARSED.valid, "Invalid format string");
+	static_assert(PARSED.fieldNum == sizeof...(Args), "Number of replacement field and argument mismatch");
+
+	constexpr auto PIECES		= std::make_index_sequence<PARSED.pieceNum>{};
+	constexpr auto CAPACITY = detail::max_format_length<Fmt, ArgTuple>(PIECES);
+
+	FormattedString<(CAPACITY == 0 ? 1 : CAPACITY)> ret_val{};
+	auto* const last = detail::format_pieces<Fmt>(ret_val.data(), ArgTuple{t_args...}, PIECES);
+
+	ret_val.resize(static_cast<std::size_t>(last - ret_val.data()));
+	return ret_val;
+}
+
+}	 // namespace cpp_stm32
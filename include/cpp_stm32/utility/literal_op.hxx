@@ -26,9 +26,9 @@
 namespace cpp_stm32 {
 
 constexpr auto operator"" _k(long double t_freq) noexcept { return t_freq * 1000; }
-constexpr auto operator"" _k(std::uint64_t t_quan) noexcept { return t_quan * 1000; }
+constexpr auto operator"" _k(unsigned long long t_quan) noexcept { return t_quan * 1000; }
 constexpr auto operator"" _M(long double t_freq) noexcept { return t_freq * 1000000; }
-constexpr auto operator"" _M(std::uint64_t t_quan) noexcept { return t_quan * 1000000; }
+constexpr auto operator"" _M(unsigned long long t_quan) noexcept { return t_quan * 1000000; }
 
 template <char... num>
 constexpr auto operator"" _Hz() noexcept {
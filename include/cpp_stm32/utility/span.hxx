@@ -0,0 +1,87 @@
+// Copyright (c) 2020 by osjacky430.
+// All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the Lesser GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// Lesser GNU General Public License for more details.
+//
+// You should have received a copy of the Lesser GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace cpp_stm32 {
+
+/**
+ * @class 	Span
+ * @brief		Non-owning view of contiguous objects, subset of C++20 std::span (dynamic extent only)
+ */
+template <typename T>
+class Span {
+ private:
+	T* m_data{nullptr};
+	std::size_t m_size{0};
+
+ public:
+	using element_type = T;
+	using iterator		 = T*;
+
+	constexpr Span() noexcept = default;
+
+	constexpr Span(T* const t_data, std::size_t const t_size) noexcept : m_data(t_data), m_size(t_size) {}
+
+	constexpr Span(T* const t_first, T* const t_last) noexcept
+		: m_data(t_first), m_size(static_cast<std::size_t>(t_last - t_first)) {
+		assert(t_first <= t_last);
+	}
+
+	template <typename U, std::size_t N>
+	constexpr Span(std::array<U, N>& t_arr) noexcept : m_data(t_arr.data()), m_size(N) {}	 // NOLINT: implicit like std::span
+
+	template <typename U, std::size_t N>
+	constexpr Span(std::array<U, N> const& t_arr) noexcept : m_data(t_arr.data()), m_size(N) {}	 // NOLINT
+
+	template <std::size_t N>
+	constexpr Span(T (&t_arr)[N]) noexcept : m_data(t_arr), m_size(N) {}	// NOLINT
+
+	[[nodiscard]] constexpr auto data() const noexcept { return m_data; }
+	[[nodiscard]] constexpr auto size() const noexcept { return m_size; }
+	[[nodiscard]] constexpr auto size_bytes() const noexcept { return m_size * sizeof(T); }
+	[[nodiscard]] constexpr auto empty() const noexcept { return m_size == 0; }
+
+	[[nodiscard]] constexpr auto begin() const noexcept { return m_data; }
+	[[nodiscard]] constexpr auto end() const noexcept { return m_data + m_size; }
+
+	[[nodiscard]] constexpr T& operator[](std::size_t const t_idx) const noexcept { return m_data[t_idx]; }
+
+	[[nodiscard]] constexpr auto first(std::size_t const t_count) const noexcept { return Span{m_data, t_count}; }
+
+	[[nodiscard]] constexpr auto subspan(std::size_t const t_offset) const noexcept {
+		return Span{m_data + t_offset, m_size - t_offset};
+	}
+
+	[[nodiscard]] constexpr auto subspan(std::size_t const t_offset, std::size_t const t_count) const noexcept {
+		return Span{m_data + t_offset, t_count};
+	}
+
+	// conversion to span of const
+	constexpr operator Span<T const>() const noexcept { return Span<T const>{m_data, m_size}; }	 // NOLINT
+};
+
+template <typename U, std::size_t N>
+Span(std::array<U, N>&) -> Span<U>;
+
+template <typename U, std::size_t N>
+Span(std::array<U, N> const&) -> Span<U const>;
+
+}	 // namespace cpp_stm32
@@ -0,0 +1,130 @@
+// Copyright (c) 2020 by osjacky430.
+// All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the Lesser GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// Lesser GNU General Public License for more details.
+//
+// You should have received a copy of the Lesser GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "cpp_stm32/utility/span.hxx"
+
+namespace cpp_stm32 {
+
+/**
+ * @class 	SpscRing
+ * @brief		Lock-free ring buffer for one producer and one consumer, e.g. main loop and interrupt handler
+ * @tparam	T 	Element type
+ * @tparam	N 	Capacity, power of 2
+ *
+ * @note 		Read and write position are free running counters, each written by one side only, and index is taken by
+ * 					masking, so all N elements are usable, and no lock or interrupt masking is needed.
+ */
+template <typename T, std::size_t N>
+class SpscRing {
+ private:
+	static_assert(N != 0 && (N & (N - 1)) == 0, "Capacity must be power of 2");
+	static_assert(N <= 0x80000000U, "Position is 32 bit");
+
+	static constexpr std::uint32_t MASK = N - 1;
+
+	std::array<T, N> m_buffer{};
+	std::atomic<std::uint32_t> m_writePos{0}; /*!< written by producer only */
+	std::atomic<std::uint32_t> m_readPos{0};	/*!< written by consumer only */
+
+ public:
+	constexpr SpscRing() noexcept = default;
+
+	SpscRing(SpscRing const&) = delete;
+	SpscRing& operator=(SpscRing const&) = delete;
+
+	[[nodiscard]] static constexpr auto capacity() noexcept { return N; }
+
+	[[nodiscard]] std::size_t size() const noexcept {
+		return m_writePos.load(std::memory_order_acquire) - m_readPos.load(std::memory_order_acquire);
+	}
+
+	[[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+	[[nodiscard]] bool full() const noexcept { return size() == N; }
+
+	/**
+	 * @brief		This function appends element, producer side
+	 * @return	false if ring is full
+	 */
+	bool push(T const& t_val) noexcept {
+		auto const write_pos = m_writePos.load(std::memory_order_relaxed);
+		if (write_pos - m_readPos.load(std::memory_order_acquire) == N) {
+			return false;
+		}
+
+		m_buffer[write_pos & MASK] = t_val;
+		m_writePos.store(write_pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief		This function appends as many elements as there is room for, producer side
+	 * @return	Number of elements appended
+	 */
+	std::size_t push(Span<T const> const t_vals) noexcept {
+		auto const write_pos = m_writePos.load(std::memory_order_relaxed);
+		auto const room			 = N - (write_pos - m_readPos.load(std::memory_order_acquire));
+		auto const count		 = t_vals.size() < room ? t_vals.size() : room;
+
+		for (std::size_t idx = 0; idx < count; ++idx) {
+			m_buffer[(write_pos + idx) & MASK] = t_vals[idx];
+		}
+
+		m_writePos.store(static_cast<std::uint32_t>(write_pos + count), std::memory_order_release);
+		return count;
+	}
+
+	/**
+	 * @brief		This function removes the oldest element, consumer side
+	 * @return	false if ring is empty, t_val is not modified in this case
+	 */
+	bool pop(T& t_val) noexcept {
+		auto const read_pos = m_readPos.load(std::memory_order_relaxed);
+		if (read_pos == m_writePos.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		t_val = m_buffer[read_pos & MASK];
+		m_readPos.store(read_pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief		This function removes as many elements as available, up to the size of output, consumer side
+	 * @return	Number of elements removed
+	 */
+	std::size_t pop(Span<T> const t_vals) noexcept {
+		auto const read_pos = m_readPos.load(std::memory_order_relaxed);
+		auto const avail		= m_writePos.load(std::memory_order_acquire) - read_pos;
+		auto const count		= t_vals.size() < avail ? t_vals.size() : avail;
+
+		for (std::size_t idx = 0; idx < count; ++idx) {
+			t_vals[idx] = m_buffer[(read_pos + idx) & MASK];
+		}
+
+		m_readPos.store(static_cast<std::uint32_t>(read_pos + count), std::memory_order_release);
+		return count;
+	}
+};
+
+}	 // namespace cpp_stm32
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "cpp_stm32/hal/host_mmio.hxx"
+
+#include "sys_init.hxx"
+
+using cpp_stm32::HostMmio;
+
+namespace {
+
+namespace rcc		= cpp_stm32::rcc;
+namespace pwr		= cpp_stm32::pwr;
+namespace flash = cpp_stm32::flash;
+
+using Trace = std::vector<std::pair<std::uint32_t, std::uint32_t>>; /*!< (address, register value after write) */
+
+constexpr auto RCC_CR		= rcc::reg::CR.memoryAddr();
+constexpr auto RCC_CFGR = rcc::reg::CFGR.memoryAddr();
+constexpr auto PWR_CR		= pwr::reg::CR.memoryAddr();
+constexpr auto PWR_CSR	= pwr::reg::CSR.memoryAddr();
+
+constexpr std::uint32_t RCC_CR_RESET_VAL			= 0x0000'0083U;
+constexpr std::uint32_t RCC_PLLCFGR_RESET_VAL = 0x2400'3010U;
+constexpr std::uint32_t RCC_CR_ON_MASK				= (1U << 0U) | (1U << 16U) | (1U << 24U);	 // HSI, HSE, PLL
+constexpr std::uint32_t RCC_CFGR_SW_MASK			= 0x3U;
+constexpr std::uint32_t PWR_CR_OD_MASK				= (1U << 16U) | (1U << 17U);	// ODEN, ODSWEN
+
+/**
+ * @brief		Emulate oscillator, clock switch and overdrive, which are ready as soon as they are enabled
+ */
+void emulate_ready_flag(std::uint32_t const t_addr, std::uint32_t const t_val) {
+	if (t_addr == RCC_CR) {
+		HostMmio::poke(RCC_CR, t_val | ((t_val & RCC_CR_ON_MASK) << 1U));
+	} else if (t_addr == RCC_CFGR) {
+		HostMmio::poke(RCC_CFGR, (t_val & ~(RCC_CFGR_SW_MASK << 2U)) | ((t_val & RCC_CFGR_SW_MASK) << 2U));
+	} else if (t_addr == PWR_CR) {
+		HostMmio::poke(PWR_CSR, t_val & PWR_CR_OD_MASK);
+	}
+}
+
+/**
+ * @brief		Clear register file, and record the value of clock registers after every write, regardless of access width
+ */
+Trace& setup_clock_hardware() {
+	static Trace trace{};
+
+	trace.clear();
+	HostMmio::reset();
+	HostMmio::poke(RCC_CR, RCC_CR_RESET_VAL);
+	HostMmio::poke(rcc::reg::PLLCFGR.memoryAddr(), RCC_PLLCFGR_RESET_VAL);
+
+	for (auto const addr : {RCC_CR, RCC_CFGR, rcc::reg::PLLCFGR.memoryAddr(), rcc::reg::APB1ENR.memoryAddr(), PWR_CR,
+													flash::reg::ACR.memoryAddr()}) {
+		for (std::uint32_t byte = 0; byte < sizeof(std::uint32_t); ++byte) {
+			HostMmio::onWrite(addr + byte, [addr](std::uint32_t const /*unused*/) {
+				auto const val = HostMmio::peek(addr);
+				trace.emplace_back(addr, val);
+				emulate_ready_flag(addr, val);
+			});
+		}
+	}
+
+	return trace;
+}
+
+}	// namespace
+
+TEST_CASE("Clock init table matches Clock::init", "[InitTable]") {
+	using Clock = cpp_stm32::sys::Clock<>;
+
+	auto const& trace = setup_clock_hardware();
+	Clock::init();
+	auto const init_trace = trace;
+	auto const init_count = HostMmio::totalAccessCount();
+
+	setup_clock_hardware();
+	Clock::init_from_table();
+	auto const table_count = HostMmio::totalAccessCount();
+
+	// every register is written with the same value, in the same order
+	REQUIRE_FALSE(init_trace.empty());
+	REQUIRE(trace == init_trace);
+
+	// one record per write, status polls aside
+	auto const poll_num = std::count_if(Clock::INIT_TABLE.begin(), Clock::INIT_TABLE.end(),
+																			[](auto const& t_record) { return t_record.op == cpp_stm32::init::Op::Poll; });
+	REQUIRE(table_count.write == init_count.write);
+	REQUIRE(table_count.write == Clock::INIT_TABLE.size() - static_cast<std::size_t>(poll_num));
+}
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "cpp_stm32/utility/cobs.hxx"
+
+namespace {
+
+using cpp_stm32::cobs_frame_size;
+using cpp_stm32::CobsDecoder;
+using cpp_stm32::CobsEncoder;
+using cpp_stm32::Crc16Ccitt;
+using cpp_stm32::Span;
+
+using Bytes = std::vector<std::uint8_t>;
+
+constexpr auto CRC_SIZE = sizeof(Crc16Ccitt::value_type);
+
+Span<std::uint8_t const> view(Bytes const& t_bytes) noexcept {
+	return Span<std::uint8_t const>{t_bytes.data(), t_bytes.size()};
+}
+
+Bytes encode(Bytes const& t_payload) {
+	Bytes buf(cobs_frame_size(t_payload.size()));
+	auto const frame = CobsEncoder{Span<std::uint8_t>{buf.data(), buf.size()}}.write(view(t_payload)).finish();
+	return Bytes(frame.begin(), frame.end());
+}
+
+/**
+ * @brief		Decoder with buffer of given payload capacity, plus room for CRC
+ */
+struct Receiver {
+	Bytes buf;
+	CobsDecoder<> decoder;
+
+	explicit Receiver(std::size_t const t_capacity)
+		: buf(t_capacity + CRC_SIZE), decoder{Span<std::uint8_t>{buf.data(), buf.size()}} {}
+
+	/**
+	 * @brief		This function feeds the data, and returns payload of every valid frame
+	 */
+	std::vector<Bytes> feed(Bytes const& t_data) {
+		std::vector<Bytes> ret_val;
+		for (auto data = view(t_data); !data.empty();) {
+			data = data.subspan(decoder.feed(data));
+
+			if (decoder.complete()) {
+				auto const payload = decoder.payload();
+				ret_val.emplace_back(payload.begin(), payload.end());
+			}
+		}
+
+		return ret_val;
+	}
+};
+
+Bytes nonzero_run(std::size_t const t_size) {
+	Bytes ret_val(t_size);
+	for (std::size_t i = 0; i < t_size; ++i) {
+		ret_val[i] = static_cast<std::uint8_t>(i % 255U + 1U);
+	}
+
+	return ret_val;
+}
+
+}	// namespace
+
+TEST_CASE("COBS frame round trips", "[Cobs]") {
+	auto const with_zeros = []() {
+		auto ret_val = nonzero_run(600);
+		for (std::size_t const idx : {0U, 253U, 254U, 300U, 599U}) {
+			ret_val[idx] = 0;
+		}
+
+		return ret_val;
+	}();
+
+	// runs of non zero byte around the block size of 254, CRC is part of the last run
+	auto const payload = GENERATE_COPY(nonzero_run(0), nonzero_run(1), nonzero_run(251), nonzero_run(252),
+																		 nonzero_run(253), nonzero_run(254), nonzero_run(255), nonzero_run(508),
+																		 Bytes(300, 0), with_zeros);
+	CAPTURE(payload.size());
+
+	auto const frame = encode(payload);
+	REQUIRE(!frame.empty());
+	REQUIRE(frame.size() <= cobs_frame_size(payload.size()));
+
+	// delimiter only at the end
+	REQUIRE(frame.back() == 0);
+	REQUIRE(std::count(frame.begin(), frame.end(), 0) == 1);
+
+	Receiver rx{payload.size()};
+	REQUIRE(rx.feed(frame) == std::vector<Bytes>{payload});
+	REQUIRE(rx.decoder.errorCount() == 0);
+}
+
+TEST_CASE("COBS encoder reports output buffer too small", "[Cobs]") {
+	auto const payload = nonzero_run(300);
+	Bytes buf(cobs_frame_size(payload.size()) - 3);
+
+	auto const frame = CobsEncoder{Span<std::uint8_t>{buf.data(), buf.size()}}.write(view(payload)).finish();
+	REQUIRE(frame.empty());
+}
+
+TEST_CASE("COBS decoder drops corrupted frame and resynchronizes at delimiter", "[Cobs]") {
+	Bytes const first{0x11, 0x00, 0x22};
+	Bytes const second{0x33, 0x44};
+
+	auto corrupted = encode(first);
+	corrupted[1] ^= 0x40U;	// flip a bit of data, the byte stays non zero
+
+	auto stream			 = corrupted;
+	auto const valid = encode(second);
+	stream.insert(stream.end(), valid.begin(), valid.end());
+
+	Receiver rx{8};
+	REQUIRE(rx.feed(stream) == std::vector<Bytes>{second});
+	REQUIRE(rx.decoder.errorCount() == 1);
+}
+
+TEST_CASE("COBS decoder drops truncated frame", "[Cobs]") {
+	auto const payload = nonzero_run(20);
+	auto frame				 = encode(payload);
+
+	// lose the tail, the delimiter of next frame ends it
+	Bytes stream(frame.begin(), frame.begin() + 10);
+	stream.push_back(0);
+	stream.insert(stream.end(), frame.begin(), frame.end());
+
+	Receiver rx{payload.size()};
+	REQUIRE(rx.feed(stream) == std::vector<Bytes>{payload});
+	REQUIRE(rx.decoder.errorCount() == 1);
+}
+
+TEST_CASE("COBS decoder drops frame longer than its buffer", "[Cobs]") {
+	auto const small = nonzero_run(4);
+	auto const large = nonzero_run(9);
+
+	auto stream			= encode(large);
+	auto const next = encode(small);
+	stream.insert(stream.end(), next.begin(), next.end());
+
+	Receiver rx{small.size()};
+	REQUIRE(rx.feed(stream) == std::vector<Bytes>{small});
+	REQUIRE(rx.decoder.errorCount() == 1);
+}
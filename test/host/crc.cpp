@@ -0,0 +1,89 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "catch2/catch.hpp"
+
+#include "cpp_stm32/utility/crc.hxx"
+
+namespace {
+
+using cpp_stm32::Crc16Ccitt;
+using cpp_stm32::Crc32;
+using cpp_stm32::Crc32Mpeg2;
+using cpp_stm32::SlicedCrc;
+using cpp_stm32::Span;
+
+constexpr std::string_view CHECK_INPUT = "123456789";
+
+Span<std::uint8_t const> check_input() noexcept {
+	return Span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(CHECK_INPUT.data()), CHECK_INPUT.size()};
+}
+
+/**
+ * @brief		Data that covers every byte value, and is not periodic in 8 byte, so that each slice sees different bytes
+ */
+std::array<std::uint8_t, 300> make_data() noexcept {
+	std::array<std::uint8_t, 300> ret_val{};
+	for (std::size_t i = 0; i < ret_val.size(); ++i) {
+		ret_val[i] = static_cast<std::uint8_t>(i * 167U + 13U);
+	}
+
+	return ret_val;
+}
+
+}	// namespace
+
+TEST_CASE("CRC of check string matches the catalogue", "[Crc]") {
+	// check values from the catalogue of parametrised CRC algorithms, CRC-16/IBM-3740 is also known as CCITT-FALSE
+	REQUIRE(Crc16Ccitt::compute(check_input()) == 0x29B1U);
+	REQUIRE(Crc32::compute(check_input()) == 0xCBF4'3926U);
+	REQUIRE(Crc32Mpeg2::compute(check_input()) == 0x0376'E6E7U);
+}
+
+TEST_CASE("CRC is the same whether data is fed at once or byte by byte", "[Crc]") {
+	Crc32 crc;
+	for (auto const byte : check_input()) {
+		crc.update(byte);
+	}
+
+	REQUIRE(crc.value() == Crc32::compute(check_input()));
+
+	crc.reset();
+	crc.update(check_input().subspan(0, 4)).update(check_input().subspan(4));
+	REQUIRE(crc.value() == Crc32::compute(check_input()));
+}
+
+TEMPLATE_TEST_CASE("Sliced CRC matches bytewise CRC", "[SlicedCrc]", Crc32, Crc32Mpeg2) {
+	REQUIRE(SlicedCrc<TestType>::compute(check_input()) == TestType::compute(check_input()));
+
+	static auto const data = make_data();
+	auto const all				 = Span<std::uint8_t const>{data};
+
+	// every length around the 8 byte step, from unaligned start
+	for (std::size_t offset = 0; offset < 8; ++offset) {
+		for (std::size_t len = 0; len < 40; ++len) {
+			auto const part = all.subspan(offset, len);
+			CAPTURE(offset, len);
+			REQUIRE(SlicedCrc<TestType>::compute(part) == TestType::compute(part));
+		}
+	}
+
+	// split at a point that isn't a multiple of 8
+	SlicedCrc<TestType> sliced;
+	sliced.update(all.subspan(0, 13)).update(all.subspan(13));
+	REQUIRE(sliced.value() == TestType::compute(all));
+}
+
+TEST_CASE("Sliced CRC of word matches bytes shifted in MSB first", "[SlicedCrc]") {
+	constexpr std::array<std::uint32_t, 3> words{0x3132'3334U, 0x3536'3738U, 0xDEAD'BEEFU};
+	constexpr std::array<std::uint8_t, 12> bytes{0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0xDE, 0xAD, 0xBE, 0xEF};
+
+	// even and odd number of word
+	for (std::size_t num = 0; num <= words.size(); ++num) {
+		CAPTURE(num);
+		REQUIRE(SlicedCrc<Crc32Mpeg2>::compute(Span{words}.subspan(0, num)) ==
+						Crc32Mpeg2::compute(Span{bytes}.subspan(0, num * 4)));
+	}
+}
@@ -0,0 +1,126 @@
+#include "catch2/catch.hpp"
+
+#include "cpp_stm32/hal/host_mmio.hxx"
+
+#include "dma.hxx"
+#include "gpio.hxx"
+#include "rcc.hxx"
+#include "usart.hxx"
+
+using cpp_stm32::HostMmio;
+
+TEST_CASE("USART send blocking", "[MmioAccessCount]") {
+	namespace usart			 = cpp_stm32::usart;
+	constexpr auto port	 = usart::Port::Usart2;
+	constexpr auto sr		 = usart::reg::SR<port>.memoryAddr();
+	constexpr auto dr		 = usart::reg::DR<port>.memoryAddr();
+	constexpr auto TXE	 = 1U << 7U;
+	constexpr auto BYTE	 = sizeof(std::uint8_t);
+	constexpr auto WORD	 = sizeof(std::uint32_t);
+	constexpr char DATA	 = 'a';
+
+	HostMmio::reset();
+	HostMmio::poke(sr, TXE);
+
+	usart::send_blocking<port>(DATA);
+
+	// TXE is polled once, and data is stored by single strb, without reading DR
+	REQUIRE(HostMmio::accessCount(sr).read == 1);
+	REQUIRE(HostMmio::accessCount(sr).write == 0);
+	REQUIRE(HostMmio::accessCount(dr, BYTE).write == 1);
+	REQUIRE(HostMmio::accessCount(dr, WORD).write == 0);
+	REQUIRE(HostMmio::accessCount(dr).read == 0);
+	REQUIRE(HostMmio::peek(dr) == DATA);
+}
+
+TEST_CASE("DMA stream reset", "[MmioAccessCount]") {
+	namespace dma				= cpp_stm32::dma;
+	constexpr auto port = dma::Port::DMA1;
+	constexpr auto str	= dma::Stream::Stream5;
+
+	HostMmio::reset();
+	dma::reg::SxCR<port, str>.sync();
+	HostMmio::resetCount();
+
+	dma::reset<port, str>();
+
+	// EN is cleared with CT read back, EN is polled once, the rest are single store without read
+	REQUIRE(HostMmio::accessCount(dma::reg::SxCR<port, str>.memoryAddr()).read == 2);
+	REQUIRE(HostMmio::accessCount(dma::reg::SxCR<port, str>.memoryAddr()).write == 2);
+	REQUIRE(HostMmio::accessCount(dma::reg::SxNDTR<port, str>.memoryAddr()).write == 1);
+	REQUIRE(HostMmio::accessCount(dma::reg::SxPAR<port, str>.memoryAddr()).write == 1);
+	REQUIRE(HostMmio::accessCount(dma::reg::SxM0AR<port, str>.memoryAddr()).write == 1);
+	REQUIRE(HostMmio::accessCount(dma::reg::SxM1AR<port, str>.memoryAddr()).write == 1);
+	REQUIRE(HostMmio::accessCount(dma::reg::SxFCR<port, str>.memoryAddr()).write == 1);
+	REQUIRE(HostMmio::totalAccessCount().read == 2);
+	REQUIRE(HostMmio::totalAccessCount().write == 8);
+}
+
+TEST_CASE("DMA build writes FIFO control of its own stream", "[MmioAccessCount]") {
+	namespace dma											= cpp_stm32::dma;
+	constexpr auto port								= dma::Port::DMA1;
+	constexpr auto str								= dma::Stream::Stream3;
+	constexpr auto fcr								= dma::reg::SxFCR<port, str>.memoryAddr();
+	constexpr auto s5par							= dma::reg::SxPAR<port, dma::Stream::Stream5>.memoryAddr();
+	constexpr std::uint32_t SENTINEL	= 0x4000'4404U;
+	constexpr std::uint32_t FTH_FULL	= 0x3U;
+	constexpr std::uint32_t DMDIS			= 1U << 2U;
+
+	HostMmio::reset();
+	HostMmio::poke(s5par, SENTINEL);
+	dma::reg::SxCR<port, str>.sync();
+	HostMmio::resetCount();
+
+	dma::DmaBuilder<port, str>{}
+		.configFIFO(dma::FifoThreshold::Full, dma::PeriphBurstSize_t{dma::BurstSize::Single},
+								dma::MemoryBurstSize_t{dma::BurstSize::Single})
+		.build();
+
+	// stream stride is 0x18, FCR of stream 3 is at 0x6C, not at S5PAR (0x90)
+	REQUIRE(fcr == dma::reg::SxCR<port, str>.memoryAddr() + 0x14U);
+	REQUIRE(HostMmio::accessCount(fcr).read == 0);
+	REQUIRE(HostMmio::accessCount(fcr).write == 1);
+	REQUIRE(HostMmio::peek(fcr) == (FTH_FULL | DMDIS));
+	REQUIRE(HostMmio::accessCount(s5par).write == 0);
+	REQUIRE(HostMmio::peek(s5par) == SENTINEL);
+}
+
+TEST_CASE("GPIO toggle", "[MmioAccessCount]") {
+	namespace gpio			= cpp_stm32::gpio;
+	constexpr auto port = gpio::Port::PortA;
+	constexpr auto odr	= gpio::reg::ODR<port>.memoryAddr();
+	constexpr auto bsrr = gpio::reg::BSRR<port>.memoryAddr();
+	constexpr auto PIN5 = 1U << 5U;
+	constexpr auto PIN6 = 1U << 6U;
+
+	HostMmio::reset();
+	HostMmio::poke(odr, PIN5);
+	HostMmio::onWrite(bsrr, [odr](std::uint32_t const t_val) {
+		HostMmio::poke(odr, (HostMmio::peek(odr) | (t_val & 0xFFFFU)) & ~(t_val >> 16U));
+	});
+
+	gpio::toggle<port, gpio::Pin::Pin5, gpio::Pin::Pin6>();
+
+	// one read of ODR, and one store to BSRR for both pins
+	REQUIRE(HostMmio::accessCount(odr).read == 1);
+	REQUIRE(HostMmio::accessCount(odr).write == 0);
+	REQUIRE(HostMmio::accessCount(bsrr).write == 1);
+	REQUIRE(HostMmio::peek(odr) == PIN6);
+}
+
+TEST_CASE("RCC enable keeps bits not declared", "[MmioAccessCount]") {
+	namespace rcc									 = cpp_stm32::rcc;
+	constexpr auto apb1enr				 = rcc::reg::APB1ENR.memoryAddr();
+	constexpr std::uint32_t DAC_EN = 1U << 29U;
+	constexpr std::uint32_t PWR_EN = 1U << 28U;
+
+	HostMmio::reset();
+	HostMmio::poke(apb1enr, DAC_EN);
+
+	rcc::enable_periph_clk<rcc::PeriphClk::Pwr>();
+
+	// DACEN isn't in the bit list, PWREN can't be written by single strb without clearing it
+	REQUIRE(HostMmio::accessCount(apb1enr).read == 1);
+	REQUIRE(HostMmio::accessCount(apb1enr).write == 1);
+	REQUIRE(HostMmio::peek(apb1enr) == (DAC_EN | PWR_EN));
+}
@@ -0,0 +1,227 @@
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "cpp_stm32/driver/poll_scheduler.hxx"
+
+namespace {
+
+namespace i2c	 = cpp_stm32::i2c;
+namespace spi	 = cpp_stm32::spi;
+namespace gpio = cpp_stm32::gpio;
+
+using cpp_stm32::Span;
+using cpp_stm32::driver::I2cAsyncCallback;
+using cpp_stm32::driver::I2cPoll;
+using cpp_stm32::driver::PollEntry;
+using cpp_stm32::driver::PollScheduler;
+using cpp_stm32::driver::SampleBuffer;
+
+constexpr std::size_t SAMPLE_SIZE = 2;
+using Sample											= std::array<std::uint8_t, SAMPLE_SIZE>;
+
+/**
+ * @brief		I2cAsync whose transaction is completed by @ref complete, which stands for I2C interrupt
+ */
+struct FakeI2c {
+	std::vector<std::uint8_t> started{}; /*!< Register of every transaction started */
+	Span<std::uint8_t> rx{};
+	I2cAsyncCallback onComplete{nullptr};
+	bool busy{false};
+	bool error{false};
+
+	bool readRegisters(i2c::SlaveAddr7_t const /*unused*/, std::uint8_t const t_reg, Span<std::uint8_t> const t_rx,
+										 I2cAsyncCallback const t_cb) noexcept {
+		if (busy) {
+			return false;
+		}
+
+		busy			 = true;
+		rx				 = t_rx;
+		onComplete = t_cb;
+		started.push_back(t_reg);
+		return true;
+	}
+
+	[[nodiscard]] bool failed() const noexcept { return error; }
+
+	/**
+	 * @brief		Fill every received byte with the register address, then complete the transaction
+	 */
+	void complete(bool const t_error = false) noexcept {
+		for (auto& val : rx) {
+			val = started.back();
+		}
+
+		busy	= false;
+		error = t_error;
+		onComplete();
+	}
+};
+
+/**
+ * @brief		SpiBus, whose transfer is synchronous, every received byte is the first byte of command
+ */
+template <spi::Port SPI>
+struct FakeSpi {
+	std::vector<std::uint8_t> started{};
+
+	bool transfer(cpp_stm32::driver::SpiDevice<SPI> const& /*unused*/, Span<std::uint8_t const> const t_tx,
+								Span<std::uint8_t> const t_rx) noexcept {
+		started.push_back(t_tx[0]);
+		for (auto& val : t_rx) {
+			val = t_tx[0];
+		}
+
+		return true;
+	}
+};
+
+constexpr I2cPoll make_poll(std::uint8_t const t_reg) noexcept { return I2cPoll{i2c::SlaveAddr7_t{0x6B}, t_reg}; }
+
+}	// namespace
+
+TEST_CASE("I2C transactions are chained from completion callback", "[PollScheduler]") {
+	static SampleBuffer<SAMPLE_SIZE> fast;
+	static SampleBuffer<SAMPLE_SIZE> slow;
+	static std::array const table{
+		PollEntry<I2cPoll>{make_poll(0x10), 2, fast.sink()},
+		PollEntry<I2cPoll>{make_poll(0x20), 5, slow.sink()},
+	};
+
+	FakeI2c bus;
+	PollScheduler scheduler{bus, table};
+
+	// both are due, only the first one is started since the bus is busy
+	scheduler.poll(0);
+	REQUIRE(bus.started == std::vector<std::uint8_t>{0x10});
+
+	// the second one is started by the callback, without poll
+	bus.complete();
+	REQUIRE(bus.started == std::vector<std::uint8_t>{0x10, 0x20});
+	bus.complete();
+	REQUIRE_FALSE(bus.busy);
+
+	Sample sample{};
+	REQUIRE(fast.read(sample) == 1);
+	REQUIRE(sample == Sample{0x10, 0x10});
+	REQUIRE(slow.read(sample) == 1);
+	REQUIRE(sample == Sample{0x20, 0x20});
+
+	// nothing is due before the next period
+	scheduler.poll(1);
+	REQUIRE(bus.started.size() == 2);
+	REQUIRE(scheduler.overrunCount() == 0);
+	REQUIRE(scheduler.failureCount() == 0);
+}
+
+TEST_CASE("I2C transactions are started earliest deadline first", "[PollScheduler]") {
+	static SampleBuffer<SAMPLE_SIZE> first;
+	static SampleBuffer<SAMPLE_SIZE> second;
+	static SampleBuffer<SAMPLE_SIZE> third;
+	static std::array const table{
+		PollEntry<I2cPoll>{make_poll(0x01), 4, first.sink()},
+		PollEntry<I2cPoll>{make_poll(0x02), 3, second.sink()},
+		PollEntry<I2cPoll>{make_poll(0x03), 100, third.sink()},
+	};
+
+	FakeI2c bus;
+	PollScheduler scheduler{bus, table};
+
+	scheduler.poll(0);
+	bus.complete();
+	bus.complete();
+	bus.complete();
+	bus.started.clear();
+
+	// entry 1 is due at 3 and entry 0 at 4, both are queued while entry 2 isn't due, then the late one runs first
+	scheduler.poll(4);
+	bus.complete();
+	REQUIRE(bus.started == std::vector<std::uint8_t>{0x02, 0x01});
+	bus.complete();
+	REQUIRE(first.count() == 2);
+	REQUIRE(second.count() == 2);
+	REQUIRE(third.count() == 1);
+}
+
+TEST_CASE("I2C entry still pending is counted as overrun", "[PollScheduler]") {
+	static SampleBuffer<SAMPLE_SIZE> busy;
+	static SampleBuffer<SAMPLE_SIZE> starved;
+	static std::array const table{
+		PollEntry<I2cPoll>{make_poll(0x01), 100, busy.sink()},
+		PollEntry<I2cPoll>{make_poll(0x02), 1, starved.sink()},
+	};
+
+	FakeI2c bus;
+	PollScheduler scheduler{bus, table};
+
+	// entry 0 holds the bus, entry 1 is queued at 0 and due again at 1 and 2
+	scheduler.poll(0);
+	scheduler.poll(1);
+	scheduler.poll(2);
+	REQUIRE(scheduler.overrunCount() == 2);
+
+	bus.complete();
+	bus.complete();
+	REQUIRE(bus.started == std::vector<std::uint8_t>{0x01, 0x02});
+	REQUIRE(starved.count() == 1);
+}
+
+TEST_CASE("Failed I2C transaction is not published", "[PollScheduler]") {
+	static SampleBuffer<SAMPLE_SIZE> sample;
+	static SampleBuffer<SAMPLE_SIZE> next;
+	static std::array const table{
+		PollEntry<I2cPoll>{make_poll(0x01), 10, sample.sink()},
+		PollEntry<I2cPoll>{make_poll(0x02), 10, next.sink()},
+	};
+
+	FakeI2c bus;
+	PollScheduler scheduler{bus, table};
+
+	scheduler.poll(0);
+	bus.complete(true);
+
+	// the failure doesn't stop the queue
+	REQUIRE(bus.started == std::vector<std::uint8_t>{0x01, 0x02});
+	bus.complete();
+
+	REQUIRE(scheduler.failureCount() == 1);
+	REQUIRE(sample.count() == 0);
+	REQUIRE(next.count() == 1);
+}
+
+TEST_CASE("SPI transactions are run back to back by poll", "[PollScheduler]") {
+	using cpp_stm32::operator""_MHz;
+	using cpp_stm32::driver::Nss;
+	using cpp_stm32::driver::SpiDevice;
+	using cpp_stm32::driver::SpiPoll;
+
+	constexpr auto port = spi::Port::SPI2;
+
+	static SpiDevice<port> const gyro{Nss<gpio::PinName::PB_12>{}, spi::Mode::Mode3, cpp_stm32::size_c<8>{}, 10_MHz};
+	static constexpr std::array<std::uint8_t, 1> gyro_cmd{0xA8};
+	static constexpr std::array<std::uint8_t, 1> accel_cmd{0xA9};
+	static SampleBuffer<SAMPLE_SIZE> gyro_sample;
+	static SampleBuffer<SAMPLE_SIZE> accel_sample;
+	static std::array const table{
+		PollEntry<SpiPoll<port>>{SpiPoll<port>{&gyro, Span{gyro_cmd}}, 2, gyro_sample.sink()},
+		PollEntry<SpiPoll<port>>{SpiPoll<port>{&gyro, Span{accel_cmd}}, 4, accel_sample.sink()},
+	};
+
+	FakeSpi<port> bus;
+	PollScheduler scheduler{bus, table};
+
+	scheduler.poll(0);
+	REQUIRE(bus.started == std::vector<std::uint8_t>{0xA8, 0xA9});
+
+	scheduler.poll(2);
+	REQUIRE(bus.started == std::vector<std::uint8_t>{0xA8, 0xA9, 0xA8});
+
+	Sample sample{};
+	REQUIRE(gyro_sample.read(sample) == 2);
+	REQUIRE(sample == Sample{0xA8, 0xA8});
+	REQUIRE(accel_sample.read(sample) == 1);
+	REQUIRE(sample == Sample{0xA9, 0xA9});
+}
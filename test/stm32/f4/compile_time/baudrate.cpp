@@ -0,0 +1,41 @@
+#include "catch2/catch.hpp"
+#include "usart.hxx"
+
+TEST_CASE("Calculate USART baudrate config", "[UsartBaudrate]") {
+	using cpp_stm32::usart::calc_baudrate_config;
+	using cpp_stm32::usart::OverSampling;
+
+	constexpr auto APB1_CLK_FREQUENCY = 45'000'000U;
+	constexpr auto APB2_CLK_FREQUENCY = 90'000'000U;
+
+	// 45 MHz / 115200 = 390.625, i.e. 391 cycles per bit
+	constexpr auto low_baud = calc_baudrate_config(APB1_CLK_FREQUENCY, 115200U);
+	STATIC_REQUIRE(low_baud.valid);
+	STATIC_REQUIRE(low_baud.over_sampling == OverSampling::OverSampling16);
+	STATIC_REQUIRE(low_baud.mantissa == 24);
+	STATIC_REQUIRE(low_baud.fraction == 7);
+	STATIC_REQUIRE(low_baud.error_ppm < 1000);
+
+	// less than 16 cycles per bit, 8x oversampling is needed
+	constexpr auto high_baud = calc_baudrate_config(APB1_CLK_FREQUENCY, 5'000'000U);
+	STATIC_REQUIRE(high_baud.valid);
+	STATIC_REQUIRE(high_baud.over_sampling == OverSampling::OverSampling8);
+	STATIC_REQUIRE(high_baud.mantissa == 1);
+	STATIC_REQUIRE(high_baud.fraction == 1);
+	STATIC_REQUIRE(high_baud.error_ppm == 0);
+
+	constexpr auto max_baud = calc_baudrate_config(APB2_CLK_FREQUENCY, 11'250'000U);
+	STATIC_REQUIRE(max_baud.valid);
+	STATIC_REQUIRE(max_baud.over_sampling == OverSampling::OverSampling8);
+	STATIC_REQUIRE(max_baud.mantissa == 1);
+	STATIC_REQUIRE(max_baud.fraction == 0);
+
+	// 7.5 cycles per bit is rounded to 8, error is 6.25 %
+	constexpr auto inexact_baud = calc_baudrate_config(APB1_CLK_FREQUENCY, 6'000'000U);
+	STATIC_REQUIRE(inexact_baud.valid);
+	STATIC_REQUIRE(inexact_baud.error_ppm == 62500);
+
+	STATIC_REQUIRE_FALSE(calc_baudrate_config(APB1_CLK_FREQUENCY, 10'000'000U).valid);
+	STATIC_REQUIRE_FALSE(calc_baudrate_config(APB1_CLK_FREQUENCY, 600U).valid);
+	STATIC_REQUIRE_FALSE(calc_baudrate_config(APB1_CLK_FREQUENCY, 0U).valid);
+}
@@ -0,0 +1,88 @@
+import argparse
+import struct
+import sys
+
+LOG_SECTION = '.cpp_stm32_log'
+ID_FORMAT = '<H'
+
+
+class LogTable:
+    """Format strings in section .cpp_stm32_log, keyed by their offset in the section (string id)"""
+
+    def __init__(self, elf_file: str):
+        with open(elf_file, 'rb') as elf:
+            self.entries = LogTable.__parse(LogTable.__read_section(elf.read()))
+
+    @staticmethod
+    def __read_section(elf: bytes) -> bytes:
+        if elf[:4] != b'\x7fELF' or elf[4] != 1 or elf[5] != 1:
+            raise ValueError('not a 32 bit little endian ELF file')
+
+        sh_off, = struct.unpack_from('<I', elf, 0x20)
+        sh_entsize, sh_num, sh_strndx = struct.unpack_from('<HHH', elf, 0x2E)
+
+        def section(idx):
+            # name, type, flags, addr, offset, size
+            return struct.unpack_from('<IIIIII', elf, sh_off + idx * sh_entsize)
+
+        str_off, str_size = section(sh_strndx)[4:6]
+        names = elf[str_off:str_off + str_size]
+
+        for idx in range(sh_num):
+            name, _, _, _, offset, size = section(idx)
+            if names[name:names.index(b'\0', name)].decode() == LOG_SECTION:
+                return elf[offset:offset + size]
+
+        raise ValueError('section ' + LOG_SECTION + ' not found, is CPP_STM32_LOG used?')
+
+    # each entry: '<' and argument type codes, '\0', format string, '\0', entries may be padded by zeros
+    @staticmethod
+    def __parse(data: bytes) -> dict:
+        entries = {}
+        pos = 0
+        while pos < len(data):
+            if data[pos] == 0:
+                pos += 1
+                continue
+
+            sig_end = data.index(b'\0', pos)
+            fmt_end = data.index(b'\0', sig_end + 1)
+            entries[pos] = (struct.Struct(data[pos:sig_end].decode()), data[sig_end + 1:fmt_end].decode())
+            pos = fmt_end + 1
+
+        return entries
+
+    def decode(self, stream):
+        """Yields rendered text of each record read from binary stream"""
+        id_size = struct.calcsize(ID_FORMAT)
+        while True:
+            raw_id = stream.read(id_size)
+            if len(raw_id) < id_size:
+                return
+
+            string_id, = struct.unpack(ID_FORMAT, raw_id)
+            if string_id not in self.entries:
+                raise ValueError('unknown string id {:#06x}, is the ELF file the one running on target?'.format(string_id))
+
+            args, fmt = self.entries[string_id]
+            raw_args = stream.read(args.size)
+            if len(raw_args) < args.size:
+                return
+
+            values = [val.decode('latin-1') if isinstance(val, bytes) else val for val in args.unpack(raw_args)]
+            yield fmt.format(*values)
+
+
+if __name__ == '__main__':
+    arg_parser = argparse.ArgumentParser(description='render records of CPP_STM32_LOG')
+    arg_parser.add_argument('elf', help='ELF file of the firmware')
+    arg_parser.add_argument('input', nargs='?', help='captured records, stdin if omitted (e.g. piped from serial port)')
+
+    cmd_input = arg_parser.parse_args()
+
+    table = LogTable(cmd_input.elf)
+    source = sys.stdin.buffer if cmd_input.input is None else open(cmd_input.input, 'rb')
+
+    with source:
+        for line in table.decode(source):
+            print(line, end='' if line.endswith('\n') else '\n', flush=True)